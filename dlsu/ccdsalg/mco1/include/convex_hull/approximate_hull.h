@@ -0,0 +1,82 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file approximate_hull.h
+ * @brief The public APIs of the approximate convex hull implementation that trades accuracy for a single linear pass.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_APPROXIMATE_HULL_H_
+#define CONVEX_HULL_APPROXIMATE_HULL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "point_buffer.h"
+
+/** @brief The number of vertical strips the points are split into, unless a number is given. */
+#define DEFAULT_APPROXIMATE_STRIP_COUNT 1024
+
+/**
+ * @brief Scans points to find an approximate convex hull in place with the Bentley-Faust-Preparata algorithm.
+ * @details This is `approximate_hull_in_place_with_strips` with `DEFAULT_APPROXIMATE_STRIP_COUNT` strips, which follows
+ * the `InPlaceScan` signature.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t approximate_hull_in_place(Point* const points, size_t point_count);
+
+/**
+ * @brief Scans points to find an approximate convex hull in place with the Bentley-Faust-Preparata algorithm.
+ * @details The points are split into vertical strips of equal widths, and only the lowest and the highest points of
+ * every strip are kept, along with the lowest and the highest of the leftmost and the rightmost points. The strips are
+ * already in order, so the kept points are sorted by sorting each strip's few points, and the monotone chain scan finds
+ * their convex hull. This takes `O(n + k)` time. The approximate convex hull is made of the given points, so it is
+ * inside the exact convex hull, and every point outside of it is at most one strip's width away from it. The points are
+ * in the same order as the Graham scans. If the strips can't be allocated, or there are too few points to be worth
+ * approximating, this finds the exact convex hull with the faster Graham scan instead.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan.
+ * @param strip_count The number of strips to split the points into. Zero is treated as one.
+ * @param[out] error_bound The largest distance of a point outside the approximate convex hull from it, or zero if the
+ * convex hull is exact.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t approximate_hull_in_place_with_strips(Point* const points, size_t point_count, size_t strip_count,
+                                             double* const error_bound);
+
+/**
+ * @brief Scans points to find an approximate convex hull with the Bentley-Faust-Preparata algorithm.
+ * @details This finds the convex hull with `approximate_hull_in_place_with_strips`, then copies it into the convex
+ * set's buffer. The convex set's buffer is only grown when it can't contain the convex hull, so reusing the same buffer
+ * across scans stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param[out] convex_points The points from the created convex set.
+ * @param strip_count The number of strips to split the points into. Zero is treated as one.
+ * @param[out] error_bound The largest distance of a point outside the approximate convex hull from it, or zero if the
+ * convex hull is exact.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool approximate_hull(PointBuffer* const points, PointBuffer* const convex_points, size_t strip_count,
+                      double* const error_bound);
+
+#endif  // CONVEX_HULL_APPROXIMATE_HULL_H_
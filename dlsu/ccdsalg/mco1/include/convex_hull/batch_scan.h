@@ -0,0 +1,65 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file batch_scan.h
+ * @brief The public APIs of the batched convex hull implementation for many small groups of points.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_BATCH_SCAN_H_
+#define CONVEX_HULL_BATCH_SCAN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "geometry.h"
+
+/** @brief The largest group of points sorted with the insertion sort algorithm instead of the heap sort algorithm. */
+#define MAX_INSERTION_SORT_GROUP_SIZE 32
+
+/** @brief The smallest number of points a thread will be given to scan. */
+#define MIN_BATCH_TASK_SIZE 65536
+
+/**
+ * @brief Scans many groups of points to find the points that would make up each group's convex hull.
+ * @details The groups are stored back-to-back in a single array, where group `i` is the points from `offsets[i]` up to
+ * `offsets[i + 1]`. Each group is copied into a reused scratch array, sorted by its x-coordinates, and y-coordinates if
+ * multiple, and scanned with Andrew's monotone chain algorithm. Groups of up to `MAX_INSERTION_SORT_GROUP_SIZE` points
+ * are sorted with the insertion sort algorithm, and larger groups with the heap sort algorithm. The convex hulls are
+ * written back-to-back in the same order as the groups, each in the same order as the Graham scans. The groups are
+ * split into contiguous runs of about the same number of points, one per thread, but no thread scans fewer than
+ * `MIN_BATCH_TASK_SIZE` points. If a thread can't be created, its run is scanned by the calling thread instead.
+ * @param[in] points The points of every group.
+ * @param[in] offsets The index of the first point of each group, followed by the total number of points. This must
+ * start with zero and never decrease.
+ * @param group_count The number of groups to scan.
+ * @param[out] convex_points The array to write the points from the created convex sets to. This must be able to contain
+ * `offsets[group_count]` points.
+ * @param[out] convex_offsets The index of the first point of each group's convex set, followed by the total number of
+ * points from the convex sets. This must be able to contain `group_count + 1` indices.
+ * @param thread_count The maximum number of threads to scan with.
+ * @return Whether the scratch arrays could be allocated. If not, the groups of the runs that couldn't be scanned are
+ * left with empty convex sets.
+ */
+bool batch_scan(const Point* const points, const size_t* const offsets, size_t group_count, Point* const convex_points,
+                size_t* const convex_offsets, size_t thread_count);
+
+#endif  // CONVEX_HULL_BATCH_SCAN_H_
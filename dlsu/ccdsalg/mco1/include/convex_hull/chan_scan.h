@@ -0,0 +1,66 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file chan_scan.h
+ * @brief The public APIs of the output-sensitive Chan's algorithm implementation.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_CHAN_SCAN_H_
+#define CONVEX_HULL_CHAN_SCAN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "point_buffer.h"
+
+/** @brief The number of points of each group in the first round of Chan's algorithm. */
+#define MIN_CHAN_GROUP_SIZE 16
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using Chan's algorithm.
+ * @details The points are split into groups of `m` points, and the convex hull of each group is found with the monotone
+ * chain, which never keeps collinear points, so the tangent searches can rely on each group being strictly convex. The
+ * wrapping's array doubles as the monotone chain's stack until the wrapping starts. Starting from the anchor point, the
+ * convex hull is then wrapped like a Jarvis march, where the next point is the most clockwise of every group's tangent,
+ * each located by a binary search. If the convex hull has more than `m` points, the wrapping is stopped and the round
+ * is repeated with `m` squared. Every point of the convex hull is also a point of its group's convex hull, so each
+ * round only keeps the points of the previous round's group convex hulls. This takes `O(n log h)` time, which is faster
+ * than the Graham scans when the convex hull is small. If the wrapping can't be allocated, this falls back to the
+ * faster Graham scan.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t chan_scan_in_place(Point* const points, size_t point_count);
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull using Chan's algorithm.
+ * @details This finds the convex hull with `chan_scan_in_place`, then copies it into the convex set's buffer. The
+ * convex set's buffer is only grown when it can't contain the convex hull, so reusing the same buffer across scans
+ * stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param[out] convex_points The points from the created convex set.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool chan_scan(PointBuffer* const points, PointBuffer* const convex_points);
+
+#endif  // CONVEX_HULL_CHAN_SCAN_H_
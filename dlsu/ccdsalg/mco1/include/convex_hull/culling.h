@@ -0,0 +1,72 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file culling.h
+ * @brief The public API of the interior point culling pre-pass.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_CULLING_H_
+#define CONVEX_HULL_CULLING_H_
+
+#include <stddef.h>
+
+#include "geometry.h"
+#include "point_soa.h"
+
+/** @brief The number of extreme points that form a quadrilateral of axis-aligned extremes. */
+#define QUADRILATERAL_DIRECTION_COUNT 4
+
+/** @brief The number of extreme points that form an octagon of axis-aligned and diagonal extremes. */
+#define OCTAGON_DIRECTION_COUNT 8
+
+/**
+ * @brief Removes the points that are strictly inside the polygon formed by the extreme points, using the Akl-Toussaint
+ * heuristic.
+ * @details This locates the points with the lowest and highest x-coordinates and y-coordinates. With eight directions,
+ * this also locates the points with the lowest and highest sums and differences of their coordinates. Those extreme
+ * points form a convex polygon inside the convex hull, so every point strictly inside it can't be part of the convex
+ * hull and is removed. The remaining points are moved to the front of the array, keeping their order. This takes a
+ * single pass to locate the extreme points and another to remove the interior points.
+ * @param[in,out] points The points to cull. This will be mutated to start with the remaining points.
+ * @param point_count The number of points to cull.
+ * @param direction_count The number of directions to locate extreme points in, either
+ * `QUADRILATERAL_DIRECTION_COUNT` or `OCTAGON_DIRECTION_COUNT`.
+ * @return The number of remaining points at the front of the array.
+ */
+size_t cull_interior_points(Point* const points, size_t point_count, size_t direction_count);
+
+/**
+ * @brief Removes the points that are strictly inside the polygon formed by the extreme points from a structure of
+ * arrays, using the Akl-Toussaint heuristic.
+ * @details This culls exactly the same points as `cull_interior_points`, but the extreme points and the interior points
+ * are located with the vectorized kernels, which hand the nearly collinear points to `orientation`. The interior points
+ * are checked in fixed-size blocks, so this never allocates. The remaining points are moved to the front of the arrays,
+ * keeping their order.
+ * @param[in,out] points The points to cull. This will be mutated to start with the remaining points, and its count will
+ * be updated.
+ * @param direction_count The number of directions to locate extreme points in, either `QUADRILATERAL_DIRECTION_COUNT`
+ * or `OCTAGON_DIRECTION_COUNT`.
+ * @return The number of remaining points at the front of the arrays.
+ */
+size_t cull_interior_points_soa(PointSoA* const points, size_t direction_count);
+
+#endif  // CONVEX_HULL_CULLING_H_
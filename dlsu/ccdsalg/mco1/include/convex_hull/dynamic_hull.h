@@ -0,0 +1,165 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file dynamic_hull.h
+ * @brief The public APIs of the fully dynamic convex hull that points are inserted into and removed from.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_DYNAMIC_HULL_H_
+#define CONVEX_HULL_DYNAMIC_HULL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "geometry.h"
+
+/** @brief The number of chains a convex hull is split into, the lower and the upper chains. */
+#define DYNAMIC_HULL_CHAIN_COUNT 2
+
+/**
+ * @brief A node of a dynamic convex hull's tree.
+ * @details Every leaf holds a distinct point, and every internal node holds the bridges between the chains of its two
+ * subtrees' convex hulls.
+ * @private
+ */
+typedef struct DynamicHullNode {
+  /** @brief The point of a leaf, or the greatest point of an internal node's left subtree. */
+  Point point;
+  /** @brief The bridge of each chain, the point from the left subtree followed by the point from the right subtree. */
+  Point bridges[DYNAMIC_HULL_CHAIN_COUNT][2];
+  /** @brief The index of the node's left child, or `SIZE_MAX` if it is a leaf. */
+  size_t left;
+  /** @brief The index of the node's right child, or `SIZE_MAX` if it is a leaf. The next free node if it is freed. */
+  size_t right;
+  /** @brief The index of the node's parent, or `SIZE_MAX` if it is the root. */
+  size_t parent;
+  /** @brief The number of leaves of the node's subtree. */
+  size_t leaf_count;
+  /** @brief The number of points of each chain of the node's subtree's convex hull. */
+  size_t chain_counts[DYNAMIC_HULL_CHAIN_COUNT];
+  /** @brief The number of times a leaf's point was inserted and not removed yet. */
+  size_t multiplicity;
+} DynamicHullNode;
+
+/**
+ * @brief A convex hull that points can be inserted into and removed from, and that can be read at any time.
+ * @details The points are the leaves of a weight-balanced tree ordered by their x-coordinates, and y-coordinates if
+ * multiple, like in the Overmars-van Leeuwen structure. Every internal node stores the bridges that join the lower and
+ * the upper chains of its subtrees' convex hulls, so a node's chains are its left subtree's chains up to the bridge,
+ * followed by its right subtree's chains from the bridge. A bridge is located by descending both subtrees at once, so
+ * inserting or removing a point recalculates the bridges of its ancestors in `O(log^2 n)` time. A subtree that becomes
+ * unbalanced is rebuilt, which is amortized over the updates.
+ */
+typedef struct DynamicHull {
+  /**
+   * @brief The nodes of the tree.
+   * @private
+   */
+  DynamicHullNode* nodes;
+  /**
+   * @brief The indices of the leaves of a subtree being rebuilt.
+   * @private
+   */
+  size_t* leaves;
+  /**
+   * @brief The index of the tree's root node, or `SIZE_MAX` if the convex hull is empty.
+   * @private
+   */
+  size_t root;
+  /** @brief The number of points inserted and not removed yet, including the duplicates. */
+  size_t point_count;
+  /**
+   * @brief The number of nodes the array can contain before it needs to grow.
+   * @private
+   */
+  size_t capacity;
+  /**
+   * @brief The number of nodes ever used from the array, including the freed ones.
+   * @private
+   */
+  size_t used_count;
+  /**
+   * @brief The index of the first freed node, or `SIZE_MAX` if there is none.
+   * @private
+   */
+  size_t free_node;
+} DynamicHull;
+
+/**
+ * @brief Initializes a dynamic convex hull to be empty.
+ * @details This doesn't allocate.
+ * @relates DynamicHull
+ * @param[in,out] hull The dynamic convex hull to initialize.
+ */
+void create_dynamic_hull(DynamicHull* const hull);
+
+/**
+ * @brief Inserts a point into a dynamic convex hull.
+ * @details A point equal to one already inserted is counted, so it stays until it is removed as many times as it was
+ * inserted. This takes `O(log^2 n)` amortized time.
+ * @relates DynamicHull
+ * @param[in,out] hull The dynamic convex hull to insert into.
+ * @param point The point to insert.
+ * @return Whether the tree could be grown to contain the point.
+ */
+bool insert_dynamic_hull_point(DynamicHull* const hull, Point point);
+
+/**
+ * @brief Removes a point from a dynamic convex hull.
+ * @details This never allocates, and takes `O(log^2 n)` amortized time.
+ * @relates DynamicHull
+ * @param[in,out] hull The dynamic convex hull to remove from.
+ * @param point The point to remove.
+ * @return Whether the point was inserted and not removed yet.
+ */
+bool remove_dynamic_hull_point(DynamicHull* const hull, Point point);
+
+/**
+ * @brief Gets the number of points that make up a dynamic convex hull.
+ * @details Every node keeps the number of points of its chains up to date, so this takes `O(1)` time.
+ * @relates DynamicHull
+ * @param[in] hull The dynamic convex hull to use.
+ * @return The number of points from the convex set.
+ */
+size_t get_dynamic_hull_point_count(const DynamicHull* const hull);
+
+/**
+ * @brief Copies the points that make up a dynamic convex hull into a caller-owned array.
+ * @details The points are in the same order as the Graham scans: counter-clockwise, starting from the point with the
+ * lowest y-coordinate, and lowest x-coordinate if multiple. This takes `O(h log n)` time.
+ * @relates DynamicHull
+ * @param[in] hull The dynamic convex hull to use.
+ * @param[out] convex_points The array to copy the points from the convex set to. This must be able to contain
+ * `get_dynamic_hull_point_count` points.
+ * @return The number of points from the convex set.
+ */
+size_t copy_dynamic_hull_points(const DynamicHull* const hull, Point* const convex_points);
+
+/**
+ * @brief Frees the tree of a dynamic convex hull.
+ * @details This resets the convex hull to be empty, so it can be reused.
+ * @relates DynamicHull
+ * @param[in,out] hull The dynamic convex hull to free.
+ */
+void destroy_dynamic_hull(DynamicHull* const hull);
+
+#endif  // CONVEX_HULL_DYNAMIC_HULL_H_
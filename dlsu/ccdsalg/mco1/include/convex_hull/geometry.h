@@ -27,6 +27,17 @@
 #ifndef CONVEX_HULL_GEOMETRY_H_
 #define CONVEX_HULL_GEOMETRY_H_
 
+/** @brief Half of the distance between 1 and the next double, which bounds the relative error of every rounding. */
+#define ROUNDING_EPSILON 1.1102230246251565e-16
+
+/**
+ * @brief The relative error bound of the orientation's cross product calculated with doubles.
+ * @details `orientation` only trusts the sign of `(a.x - b.x) * (vertex.y - b.y) - (a.y - b.y) * (vertex.x - b.x)` if
+ * it is at least this times the sum of the products' magnitudes away from zero, so vectorized orientations that
+ * calculate the same products can defer to it exactly when it would recalculate them.
+ */
+#define ORIENTATION_ERROR_BOUND ((3.0 + 16.0 * ROUNDING_EPSILON) * ROUNDING_EPSILON)
+
 /** @brief A point within a Cartesian plane. */
 typedef struct Point {
   /** @brief The x-coordinate of the point. */
@@ -47,13 +58,45 @@ double distance(const Point* const a, const Point* const b);
 
 /**
  * @brief Calculates the orientation of the angle formed by connecting three points.
- * @details This uses the cross product of the two vectors formed by the three points to determine the orientation.
+ * @details This uses the cross product of the two vectors formed by the three points to determine the orientation. The
+ * cross product is first calculated with doubles, which is only trusted if it is farther from zero than its rounding
+ * error can be. Otherwise, the cross product is recalculated adaptively with exact floating-point expansions, like
+ * Shewchuk's robust predicates, so nearly collinear points always get the correct orientation.
  * @param[in] vertex The vertex to use.
  * @param[in] b The third point to use.
  * @return `-1` if the angle is clockwise, `1` if counter-clockwise, or `0` if collinear.
  */
 int orientation(const Point* const a, const Point* const vertex, const Point* const b);
 
+/**
+ * @brief Compares the intersection of two lines with a point by their x-coordinates, and y-coordinates if equal.
+ * @details The intersection is never rounded. Its coordinates relative to the point are fractions of cross products,
+ * whose signs are first calculated with doubles and only trusted if they are farther from zero than their rounding
+ * errors can be. Otherwise, they are recalculated exactly with the same floating-point expansions as `orientation`.
+ * @param[in] a The start of the first line.
+ * @param[in] b The end of the first line.
+ * @param[in] c The start of the second line.
+ * @param[in] d The end of the second line. The lines must not be parallel.
+ * @param[in] point The point to compare against.
+ * @return `-1` if the intersection comes before the point, `1` if after, or `0` if they are the same point.
+ */
+int compare_intersection(const Point* const a, const Point* const b, const Point* const c, const Point* const d,
+                         const Point* const point);
+
+/**
+ * @brief Compares the cross products of a line with two points, which orders the points by their signed distances from
+ * the line.
+ * @details The cross products are never rounded. Their difference is first calculated with doubles, which is only
+ * trusted if it is farther from zero than its rounding error can be. Otherwise, both are recalculated exactly with the
+ * same floating-point expansions as `orientation`.
+ * @param[in] a The start of the line.
+ * @param[in] b The end of the line.
+ * @param[in] c The first point to compare.
+ * @param[in] d The second point to compare.
+ * @return `-1` if the cross product with `c` is less than with `d`, `1` if greater, or `0` if they are equal.
+ */
+int compare_areas(const Point* const a, const Point* const b, const Point* const c, const Point* const d);
+
 /**
  * @brief Calculates the polar angle of a point.
  * @param[in] point The point to calculate the polar angle of.
@@ -62,4 +105,23 @@ int orientation(const Point* const a, const Point* const vertex, const Point* co
  */
 double polar_angle(const Point* const point, const Point* const anchor_point);
 
+/**
+ * @brief Calculates the squared distance between two points.
+ * @details This orders points exactly like `distance`, but without the square root.
+ * @param[in] a The first point to use.
+ * @param[in] b The second point to use.
+ * @return The squared distance between point `a` and point `b`.
+ */
+double squared_distance(const Point* const a, const Point* const b);
+
+/**
+ * @brief Calculates the pseudo-angle of a point.
+ * @details This increases with the polar angle, ranging from `-2` to `2` instead of from `-pi` to `pi`, but uses a
+ * single division instead of a trigonometric function.
+ * @param[in] point The point to calculate the pseudo-angle of.
+ * @param[in] anchor_point The anchor or origin point to use.
+ * @return The pseudo-angle of a point.
+ */
+double pseudo_angle(const Point* const point, const Point* const anchor_point);
+
 #endif  // CONVEX_HULL_GEOMETRY_H_
@@ -0,0 +1,97 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file graham_scan.h
+ * @brief The public APIs of the phases shared by the Graham scan implementations.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_GRAHAM_SCAN_H_
+#define CONVEX_HULL_GRAHAM_SCAN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "geometry.h"
+
+/**
+ * @brief Locates the point with the lowest y-coordinate, and lowest x-coordinate if multiple.
+ * @details This is the first phase of a Graham scan. The points are then sorted around this anchor point.
+ * @param[in] points The points to search.
+ * @param point_count The number of points to search. This must be at least one.
+ * @return The anchor point.
+ */
+Point find_anchor_point(const Point* const points, size_t point_count);
+
+/**
+ * @brief Checks points already sorted around the anchor point one-by-one for the direction of the angle they form.
+ * @details This is the last phase of a Graham scan. All points starting from the anchor point that have a
+ * counter-clockwise direction form the convex hull. This never allocates. The array doubles as the scan's stack, so it
+ * must fit every point the scan has yet to reject.
+ * @param[in] points The sorted points to check.
+ * @param point_count The number of points to check. This must be at least three.
+ * @param[in] anchor_point The anchor point the points were sorted around.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_count The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_count` always fits.
+ */
+bool scan_sorted_points_into(const Point* const points, size_t point_count, const Point* const anchor_point,
+                             Point* const convex_points, size_t convex_point_capacity,
+                             size_t* const convex_point_count);
+
+/**
+ * @brief Checks points already sorted around the anchor point one-by-one for the direction of the angle they form, in
+ * place.
+ * @details This is the last phase of a Graham scan. Instead of pushing copies into a separate stack, the sorted array's
+ * prefix is used as the stack, so the convex set ends up at the front of the array and no extra memory is needed.
+ * @param[in,out] points The sorted points to check. This will be mutated to start with the points from the created
+ * convex set.
+ * @param point_count The number of points to check. This must be at least three.
+ * @param[in] anchor_point The anchor point the points were sorted around.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t scan_sorted_points_in_place(Point* const points, size_t point_count, const Point* const anchor_point);
+
+/**
+ * @brief Finds the convex set of fewer than three points in place.
+ * @details These are too few for the phases of a Graham scan, but their convex set is in the same order. A duplicate
+ * point is removed, and the point with the lowest y-coordinate, and lowest x-coordinate if multiple, comes first.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan. This must be less than three.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t scan_degenerate_points_in_place(Point* const points, size_t point_count);
+
+/**
+ * @brief Finds the convex set of fewer than three points into a caller-owned array.
+ * @details This finds the convex set with `scan_degenerate_points_in_place`, then copies it into the array.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan. This must be less than three.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_count The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_count` always fits.
+ */
+bool scan_degenerate_points_into(Point* const points, size_t point_count, Point* const convex_points,
+                                 size_t convex_point_capacity, size_t* const convex_point_count);
+
+#endif  // CONVEX_HULL_GRAHAM_SCAN_H_
@@ -27,21 +27,55 @@
 #ifndef CONVEX_HULL_GRAHAM_SCAN2_H_
 #define CONVEX_HULL_GRAHAM_SCAN2_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 
-#include "geometry.h"
+#include "point_buffer.h"
 
 /**
- * @brief Scans points to find the points that would make up the convex hull using a faster sorting algorithm.
+ * @brief Scans points to find the points that would make up the convex hull into a caller-owned array using a faster
+ * sorting algorithm.
  * @details This locates the point with the lowest y-coordinate, and lowest x-coordinate if multiple, and sets it as the
- * anchor point. The points are sorted using the heap sort algorithm. Then, they are checked one-by-one for the
- * direction of the angle they form. All points starting from the anchor point that have a counter-clockwise direction
- * form the convex hull.
+ * anchor point. The points are sorted using the radix sort algorithm on precalculated keys, or the heap sort algorithm
+ * if there are only a few points or the keys can't be allocated. Then, they are checked one-by-one for the direction of
+ * the angle they form. All points starting from the anchor point that have a counter-clockwise direction form the
+ * convex hull. Only the sorting keys are allocated. The array doubles as the scan's stack, so it must fit every point
+ * the scan has yet to reject.
  * @param[in,out] points The points to scan. This will be mutated to be sorted.
  * @param point_count The number of points to scan.
- * @param[out] convex_points The points from the created convex set.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
  * @param[out] convex_point_count The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_count` always fits.
+ */
+bool fast_scan_into(Point* const points, size_t point_count, Point* const convex_points, size_t convex_point_capacity,
+                    size_t* const convex_point_count);
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using a faster sorting algorithm.
+ * @details This locates the point with the lowest y-coordinate, and lowest x-coordinate if multiple, and sets it as the
+ * anchor point. The points are sorted using the radix sort algorithm on precalculated keys, or the heap sort algorithm
+ * if there are only a few points or the keys can't be allocated. Then, they are checked one-by-one for the direction of
+ * the angle they form. Instead of pushing copies into a separate stack, the sorted array's prefix is used as the stack,
+ * so the convex set ends up at the front of the array and only the sorting keys need extra memory.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t fast_scan_in_place(Point* const points, size_t point_count);
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull using a faster sorting algorithm.
+ * @details This locates the point with the lowest y-coordinate, and lowest x-coordinate if multiple, and sets it as the
+ * anchor point. The points are sorted using the radix sort algorithm on precalculated keys, or the heap sort algorithm
+ * if there are only a few points or the keys can't be allocated. Then, they are checked one-by-one for the direction of
+ * the angle they form. All points starting from the anchor point that have a counter-clockwise direction form the
+ * convex hull. The convex set's buffer is only grown when it can't contain all of the points, so reusing the same
+ * buffer across scans stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param[out] convex_points The points from the created convex set.
+ * @return Whether the convex set's buffer could be grown.
  */
-void fast_scan(Point* const points, size_t point_count, Point** const convex_points, size_t* const convex_point_count);
+bool fast_scan(PointBuffer* const points, PointBuffer* const convex_points);
 
 #endif  // CONVEX_HULL_GRAHAM_SCAN2_H_
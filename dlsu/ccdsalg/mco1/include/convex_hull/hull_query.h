@@ -0,0 +1,108 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file hull_query.h
+ * @brief The public APIs of the index that checks whether points are inside a convex hull.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_HULL_QUERY_H_
+#define CONVEX_HULL_HULL_QUERY_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "geometry.h"
+#include "point_soa.h"
+
+/** @brief The number of points whose results are packed into a single word of a containment mask. */
+#define HULL_QUERY_MASK_BITS 64
+
+/**
+ * @brief Calculates the number of words of a containment mask that can contain the results of a number of points.
+ * @param point_count The number of points to check.
+ * @return The number of words of the containment mask.
+ */
+#define HULL_QUERY_MASK_WORD_COUNT(point_count) (((point_count) + HULL_QUERY_MASK_BITS - 1) / HULL_QUERY_MASK_BITS)
+
+/**
+ * @brief An index of a convex hull that checks whether points are inside it.
+ * @details The convex hull is split into a fan of triangles around its anchor, the first point of the convex hull. The
+ * anchor has the lowest y-coordinate, so the fan's edges are sorted by their angles, and the triangle a point can be
+ * inside is located with a binary search over them. A point is then checked against the triangle's single edge from
+ * the convex hull, so every query takes `O(log h)` time.
+ */
+typedef struct HullQuery {
+  /**
+   * @brief The points of the convex hull in counter-clockwise order, starting from the anchor.
+   * @private
+   */
+  PointSoA points;
+} HullQuery;
+
+/**
+ * @brief Builds the index of a convex hull.
+ * @details The points must be in the same order as the Graham scans: counter-clockwise, starting from the point with
+ * the lowest y-coordinate, and lowest x-coordinate if multiple, without collinear points. The convex hull can have
+ * fewer than three points, in which case it is a single point, a line segment, or empty.
+ * @relates HullQuery
+ * @param[in,out] query The index to build.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_count The number of points from the convex set.
+ * @return Whether the index could be allocated.
+ */
+bool create_hull_query(HullQuery* const query, const Point* const convex_points, size_t convex_point_count);
+
+/**
+ * @brief Checks if a point is inside a convex hull, including its boundary.
+ * @details Every orientation is calculated with `orientation`, so points on the boundary are always included.
+ * @relates HullQuery
+ * @param[in] query The index of the convex hull to use.
+ * @param[in] point The point to check.
+ * @return Whether the point is inside the convex hull or on its boundary.
+ */
+bool is_point_inside_hull(const HullQuery* const query, const Point* const point);
+
+/**
+ * @brief Checks which points of a batch are inside a convex hull, including its boundary.
+ * @details The result of the point at index `i` is stored in bit `i % HULL_QUERY_MASK_BITS` of the mask's word at index
+ * `i / HULL_QUERY_MASK_BITS`. With AVX2, four points are searched at a time, with their fan edges gathered from the
+ * index. The orientations are calculated with doubles like the other batch kernels, and the points whose orientations
+ * are too close to call are checked with `is_point_inside_hull`, so every result is the same as its.
+ * @relates HullQuery
+ * @param[in] query The index of the convex hull to use.
+ * @param[in] points The points to check.
+ * @param[out] is_inside_mask Whether each point is inside the convex hull. This must be able to contain
+ * `HULL_QUERY_MASK_WORD_COUNT(points->count)` words.
+ */
+void find_points_inside_hull(const HullQuery* const query, const PointSoA* const points,
+                             uint64_t* const is_inside_mask);
+
+/**
+ * @brief Frees the index of a convex hull.
+ * @details This resets the index to an empty convex hull, so it can be reused.
+ * @relates HullQuery
+ * @param[in,out] query The index to free.
+ */
+void destroy_hull_query(HullQuery* const query);
+
+#endif  // CONVEX_HULL_HULL_QUERY_H_
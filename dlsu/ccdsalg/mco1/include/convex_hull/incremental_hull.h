@@ -0,0 +1,152 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file incremental_hull.h
+ * @brief The public APIs of the online convex hull that points are inserted into one-by-one.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_INCREMENTAL_HULL_H_
+#define CONVEX_HULL_INCREMENTAL_HULL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "geometry.h"
+
+/**
+ * @brief A node of a hull chain's treap.
+ * @private
+ */
+typedef struct HullChainNode {
+  /** @brief The point of the node. */
+  Point point;
+  /** @brief The index of the node's left child, or `SIZE_MAX` if it has none. */
+  size_t left;
+  /** @brief The index of the node's right child, or `SIZE_MAX` if it has none. The next free node if it is freed. */
+  size_t right;
+  /** @brief The random heap priority of the node. */
+  uint32_t priority;
+} HullChainNode;
+
+/**
+ * @brief A half of a convex hull, with its points ordered by their x-coordinates, and y-coordinates if multiple.
+ * @details The points are stored in a treap, so locating the neighbors of a point and inserting or removing a point
+ * take logarithmic time. The nodes are stored in a single growable array, and removed nodes are reused.
+ */
+typedef struct HullChain {
+  /**
+   * @brief The nodes of the treap.
+   * @private
+   */
+  HullChainNode* nodes;
+  /**
+   * @brief The index of the treap's root node, or `SIZE_MAX` if the chain is empty.
+   * @private
+   */
+  size_t root;
+  /** @brief The number of points of the chain. */
+  size_t count;
+  /**
+   * @brief The number of nodes the array can contain before it needs to grow.
+   * @private
+   */
+  size_t capacity;
+  /**
+   * @brief The number of nodes ever used from the array, including the freed ones.
+   * @private
+   */
+  size_t used_count;
+  /**
+   * @brief The index of the first freed node, or `SIZE_MAX` if there is none.
+   * @private
+   */
+  size_t free_node;
+  /**
+   * @brief The state of the generator of the nodes' priorities.
+   * @private
+   */
+  uint32_t random_state;
+} HullChain;
+
+/**
+ * @brief A convex hull that points are inserted into one-by-one, and that can be read at any time.
+ * @details The lower and the upper halves of the convex hull are kept as separate chains that both start from the
+ * leftmost point and end on the rightmost point, like in Andrew's monotone chain algorithm. An inserted point that is
+ * outside a chain is added to it, and the neighbors it makes concave are removed. Since every point is removed at most
+ * once, inserting a point takes `O(log h)` amortized time.
+ */
+typedef struct IncrementalHull {
+  /** @brief The lower half of the convex hull. */
+  HullChain lower_chain;
+  /** @brief The upper half of the convex hull. */
+  HullChain upper_chain;
+} IncrementalHull;
+
+/**
+ * @brief Initializes an incremental convex hull to be empty.
+ * @details This doesn't allocate.
+ * @relates IncrementalHull
+ * @param[in,out] hull The incremental convex hull to initialize.
+ */
+void create_incremental_hull(IncrementalHull* const hull);
+
+/**
+ * @brief Inserts a point into an incremental convex hull.
+ * @details A point inside or on the boundary of the convex hull leaves it unchanged.
+ * @relates IncrementalHull
+ * @param[in,out] hull The incremental convex hull to insert into.
+ * @param point The point to insert.
+ * @return Whether the chains could be grown to contain the point.
+ */
+bool insert_incremental_hull_point(IncrementalHull* const hull, Point point);
+
+/**
+ * @brief Gets the number of points that make up an incremental convex hull.
+ * @details This takes constant time.
+ * @relates IncrementalHull
+ * @param[in] hull The incremental convex hull to use.
+ * @return The number of points from the convex set.
+ */
+size_t get_incremental_hull_point_count(const IncrementalHull* const hull);
+
+/**
+ * @brief Copies the points that make up an incremental convex hull into a caller-owned array.
+ * @details The points are in the same order as the Graham scans: counter-clockwise, starting from the point with the
+ * lowest y-coordinate, and lowest x-coordinate if multiple. This takes linear time in the size of the convex hull.
+ * @relates IncrementalHull
+ * @param[in] hull The incremental convex hull to use.
+ * @param[out] convex_points The array to copy the points from the convex set to. This must be able to contain
+ * `get_incremental_hull_point_count` points.
+ * @return The number of points from the convex set.
+ */
+size_t copy_incremental_hull_points(const IncrementalHull* const hull, Point* const convex_points);
+
+/**
+ * @brief Frees the chains of an incremental convex hull.
+ * @details This resets the convex hull to be empty, so it can be reused.
+ * @relates IncrementalHull
+ * @param[in,out] hull The incremental convex hull to free.
+ */
+void destroy_incremental_hull(IncrementalHull* const hull);
+
+#endif  // CONVEX_HULL_INCREMENTAL_HULL_H_
@@ -0,0 +1,104 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file integer_hull.h
+ * @brief The public APIs of the exact convex hull specialization for integer coordinates.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_INTEGER_HULL_H_
+#define CONVEX_HULL_INTEGER_HULL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "geometry.h"
+
+/** @brief A point within a Cartesian plane with 32-bit integer coordinates. */
+typedef struct IntegerPoint {
+  /** @brief The x-coordinate of the point. */
+  int32_t x;
+  /** @brief The y-coordinate of the point. */
+  int32_t y;
+} IntegerPoint;
+
+/**
+ * @brief Converts points into integer points.
+ * @details This only succeeds if every coordinate is an integer that fits into 32 bits, so the conversion is exact.
+ * @param[in] points The points to convert.
+ * @param point_count The number of points to convert.
+ * @param[out] integer_points The array to write the integer points to.
+ * @return Whether every coordinate could be converted exactly.
+ */
+bool to_integer_points(const Point* const points, size_t point_count, IntegerPoint* const integer_points);
+
+/**
+ * @brief Converts integer points back into points.
+ * @param[in] integer_points The integer points to convert.
+ * @param point_count The number of points to convert.
+ * @param[out] points The array to write the points to.
+ */
+void from_integer_points(const IntegerPoint* const integer_points, size_t point_count, Point* const points);
+
+/**
+ * @brief Calculates the orientation of the angle formed by connecting three integer points exactly.
+ * @details This uses the cross product of the two vectors formed by the three points, like `orientation`. The
+ * coordinates' differences take 33 bits, so their products are calculated with 128-bit integers when the compiler
+ * supports them. Otherwise, each product's magnitude fits into an unsigned 64-bit integer, and the two products are
+ * compared by their signs and magnitudes. Either way, there is no rounding, so collinear points are always detected.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @param[in] b The third point to use.
+ * @return `-1` if the angle is clockwise, `1` if counter-clockwise, or `0` if collinear.
+ */
+int integer_orientation(const IntegerPoint* const a, const IntegerPoint* const vertex, const IntegerPoint* const b);
+
+/**
+ * @brief Sorts integer points by their x-coordinate or y-coordinate in ascending order using the radix sort algorithm.
+ * @details Each point's coordinates are offset to be unsigned and packed into a single 64-bit key, which orders like
+ * the point. The keys are sorted by their bits, least significant first, and unpacked back into the points. Passes
+ * where every key has the same digit are skipped, so small coordinate ranges take fewer passes.
+ * @param[in,out] points The points to sort.
+ * @param point_count The number of points to sort.
+ * @return Whether the memory for the keys could be allocated. The points are left unsorted if not.
+ */
+bool integer_radix_sort(IntegerPoint* const points, size_t point_count);
+
+/**
+ * @brief Scans integer points to find the points that would make up the convex hull into a caller-owned array using
+ * Andrew's monotone chain algorithm.
+ * @details This sorts the points with `integer_radix_sort`, or the heap sort algorithm if the keys can't be allocated.
+ * Then, the lower and the upper halves of the convex hull are built like `monotone_chain_scan_into`, but with
+ * `integer_orientation`, so near-collinear points never make the scan unstable. The convex hull is rotated to start
+ * from the point with the lowest y-coordinate, and lowest x-coordinate if multiple, to match the order of the Graham
+ * scans. This never allocates other than the keys.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param point_count The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_count The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_count` always fits.
+ */
+bool integer_monotone_chain_scan_into(IntegerPoint* const points, size_t point_count, IntegerPoint* const convex_points,
+                                      size_t convex_point_capacity, size_t* const convex_point_count);
+
+#endif  // CONVEX_HULL_INTEGER_HULL_H_
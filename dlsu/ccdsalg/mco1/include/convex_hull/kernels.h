@@ -0,0 +1,137 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file kernels.h
+ * @brief The public APIs of the vectorized batch geometry kernels and their runtime dispatch.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_KERNELS_H_
+#define CONVEX_HULL_KERNELS_H_
+
+#include <stddef.h>
+
+#include "geometry.h"
+#include "point_soa.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/** @brief Whether the x86 vectorized kernels are compiled, which needs GCC's per-function target attributes. */
+#define HAS_X86_KERNELS 1
+#else
+#define HAS_X86_KERNELS 0
+#endif
+
+/** @brief The number of directions the extreme points are located in. */
+#define EXTREME_DIRECTION_COUNT 8
+
+/** @brief The instruction sets the kernels can be dispatched to, from the slowest to the fastest. */
+typedef enum InstructionSet {
+  /** @brief Plain C, one point at a time. */
+  SCALAR_INSTRUCTION_SET = 0,
+  /** @brief Two points at a time in 128-bit vectors. */
+  SSE2_INSTRUCTION_SET = 1,
+  /** @brief Four points at a time in 256-bit vectors. */
+  AVX2_INSTRUCTION_SET = 2,
+} InstructionSet;
+
+/** @brief The smallest axis-aligned rectangle containing a set of points. */
+typedef struct BoundingBox {
+  /** @brief The lowest x-coordinate of the points. */
+  double min_x;
+  /** @brief The lowest y-coordinate of the points. */
+  double min_y;
+  /** @brief The highest x-coordinate of the points. */
+  double max_x;
+  /** @brief The highest y-coordinate of the points. */
+  double max_y;
+} BoundingBox;
+
+/**
+ * @brief Gets the fastest instruction set supported by the processor.
+ * @details This is detected at runtime, so the same executable runs on processors without vector extensions.
+ * @return The fastest supported instruction set.
+ */
+InstructionSet get_supported_instruction_set(void);
+
+/**
+ * @brief Gets the instruction set the kernels are dispatched to.
+ * @details This defaults to the fastest supported instruction set.
+ * @return The instruction set in use.
+ */
+InstructionSet get_instruction_set(void);
+
+/**
+ * @brief Sets the instruction set the kernels are dispatched to.
+ * @details This is meant for benchmarking and testing. An unsupported instruction set falls back to the fastest
+ * supported one.
+ * @param instruction_set The instruction set to use.
+ */
+void set_instruction_set(InstructionSet instruction_set);
+
+/**
+ * @brief Calculates the orientations of the angles formed by two fixed points and each point of a batch.
+ * @details Every orientation is identical to the one calculated by `orientation(a, vertex, point)`. The vectorized
+ * kernels calculate the same products as `orientation`, and the points whose cross products are within its error bound
+ * of zero are handed to it, so nearly collinear points get the exact orientation on every instruction set.
+ * @param[in] points The points to use as the third points of the angles.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @param[out] orientations The orientations of the angles, `-1` if clockwise, `1` if counter-clockwise, or `0` if
+ * collinear. This must be able to contain all of the points.
+ */
+void batch_orientation(const PointSoA* const points, const Point* const a, const Point* const vertex,
+                       signed char* const orientations);
+
+/**
+ * @brief Calculates the bounding box of a batch of points.
+ * @param[in] points The points to use.
+ * @param[out] box The bounding box of the points.
+ * @pre The batch contains at least one point.
+ */
+void find_bounding_box(const PointSoA* const points, BoundingBox* const box);
+
+/**
+ * @brief Locates the extreme points of a batch of points in eight directions.
+ * @details The directions are in counter-clockwise order, starting from the bottom: the lowest y-coordinate, the
+ * highest `x - y`, the highest x-coordinate, the highest `x + y`, the highest y-coordinate, the highest `y - x`, the
+ * lowest x-coordinate, and the lowest `x + y`. If multiple points are extreme in a direction, the first is used.
+ * @param[in] points The points to search.
+ * @param[out] extreme_indexes The indexes of the extreme points in each direction.
+ * @pre The batch contains at least one point.
+ */
+void find_extreme_points(const PointSoA* const points, size_t extreme_indexes[EXTREME_DIRECTION_COUNT]);
+
+/**
+ * @brief Checks which points of a batch are strictly inside a convex polygon.
+ * @details The polygon's vertices must be in counter-clockwise order without repeated vertices. A point is strictly
+ * inside if `orientation(start, end, point)` is positive for every edge of the polygon. Like `batch_orientation`, the
+ * points whose cross products are within `orientation`'s error bound of zero are handed to it, so the result is the
+ * same on every instruction set.
+ * @param[in] points The points to check.
+ * @param[in] vertices The vertices of the polygon.
+ * @param vertex_count The number of vertices of the polygon.
+ * @param[out] is_inside Whether each point is strictly inside the polygon. This must be able to contain all of the
+ * points.
+ */
+void find_strictly_inside(const PointSoA* const points, const Point* const vertices, size_t vertex_count,
+                          unsigned char* const is_inside);
+
+#endif  // CONVEX_HULL_KERNELS_H_
@@ -0,0 +1,88 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file monotone_chain.h
+ * @brief The public API of the monotone chain implementation.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_MONOTONE_CHAIN_H_
+#define CONVEX_HULL_MONOTONE_CHAIN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "point_buffer.h"
+
+/**
+ * @brief Scans points already sorted by their x-coordinates, and y-coordinates if multiple, to find the points that
+ * would make up the convex hull into a caller-owned array using Andrew's monotone chain algorithm.
+ * @details This is `monotone_chain_scan_into` without the sorting, so the phases can be timed separately. The lower
+ * and the upper halves of the convex hull are built by checking the points below and above the line between the
+ * leftmost and the rightmost points one-by-one, from left to right and then from right to left, for the direction of
+ * the angle they form. This never allocates.
+ * @param[in] points The sorted points to scan.
+ * @param point_count The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_count The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_count` always fits.
+ */
+bool monotone_chain_scan_sorted_into(const Point* const points, size_t point_count, Point* const convex_points,
+                                     size_t convex_point_capacity, size_t* const convex_point_count);
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull into a caller-owned array using Andrew's
+ * monotone chain algorithm.
+ * @details This sorts the points by their x-coordinates, and y-coordinates if multiple, using the heap sort algorithm.
+ * Then, the lower and the upper halves of the convex hull are built by checking the points below and above the line
+ * between the leftmost and the rightmost points one-by-one, from left to right and then from right to left, for the
+ * direction of the angle they form. Only the orientation of the points is
+ * ever compared, so the sorting never calculates polar angles or distances. The convex hull is rotated to start from
+ * the point with the lowest y-coordinate, and lowest x-coordinate if multiple, to match the order of the Graham scans.
+ * This never allocates. The array doubles as the scan's stack, so it must fit every point the scan has yet to reject.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param point_count The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_count The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_count` always fits.
+ */
+bool monotone_chain_scan_into(Point* const points, size_t point_count, Point* const convex_points,
+                              size_t convex_point_capacity, size_t* const convex_point_count);
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull using Andrew's monotone chain algorithm.
+ * @details This sorts the points by their x-coordinates, and y-coordinates if multiple, using the heap sort algorithm.
+ * Then, the lower and the upper halves of the convex hull are built by checking the points below and above the line
+ * between the leftmost and the rightmost points one-by-one, from left to right and then from right to left, for the
+ * direction of the angle they form. Only the orientation of the points is
+ * ever compared, so the sorting never calculates polar angles or distances. The convex hull is rotated to start from
+ * the point with the lowest y-coordinate, and lowest x-coordinate if multiple, to match the order of the Graham scans.
+ * The convex set's buffer is only grown when it can't contain all of the points, so reusing the same buffer across
+ * scans stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param[out] convex_points The points from the created convex set.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool monotone_chain_scan(PointBuffer* const points, PointBuffer* const convex_points);
+
+#endif  // CONVEX_HULL_MONOTONE_CHAIN_H_
@@ -0,0 +1,80 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file parallel_scan.h
+ * @brief The public APIs of the multithreaded divide and conquer convex hull implementation.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_PARALLEL_SCAN_H_
+#define CONVEX_HULL_PARALLEL_SCAN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "point_buffer.h"
+
+/** @brief The smallest number of points a thread will be given to scan. */
+#define MIN_PARALLEL_CHUNK_SIZE 65536
+
+/**
+ * @brief A function that scans points to find the points that would make up the convex hull in place.
+ * @details `slow_scan_in_place` and `fast_scan_in_place` both follow this signature.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+typedef size_t (*InPlaceScan)(Point* const points, size_t point_count);
+
+/**
+ * @brief Gets the number of processors available to run threads on.
+ * @return The number of online processors, or `1` if it can't be determined.
+ */
+size_t get_processor_count(void);
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using multiple threads.
+ * @details The points are split into contiguous chunks, one per thread, and each thread finds its chunk's convex hull
+ * in place with the scan. Every point of the convex hull is also a point of its chunk's convex hull, so the partial
+ * convex hulls are moved to the front of the array and scanned once more to merge them. Small inputs are given fewer
+ * threads, so no thread scans fewer than `MIN_PARALLEL_CHUNK_SIZE` points. If a thread can't be created, its chunk is
+ * scanned by the calling thread instead.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan.
+ * @param thread_count The maximum number of threads to scan with.
+ * @param scan The scan to find each convex hull with.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t parallel_scan_in_place(Point* const points, size_t point_count, size_t thread_count, InPlaceScan scan);
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull using multiple threads.
+ * @details This finds the convex hull with `parallel_scan_in_place` and the faster Graham scan, then copies it into the
+ * convex set's buffer. The convex set's buffer is only grown when it can't contain the convex hull, so reusing the same
+ * buffer across scans stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param[out] convex_points The points from the created convex set.
+ * @param thread_count The maximum number of threads to scan with.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool parallel_scan(PointBuffer* const points, PointBuffer* const convex_points, size_t thread_count);
+
+#endif  // CONVEX_HULL_PARALLEL_SCAN_H_
@@ -0,0 +1,92 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file point_buffer.h
+ * @brief The public APIs of the growable point buffer and its helper functions.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_POINT_BUFFER_H_
+#define CONVEX_HULL_POINT_BUFFER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "geometry.h"
+
+/** @brief The number of points a point buffer can contain after its first allocation. */
+#define MIN_POINT_BUFFER_CAPACITY 16
+
+/**
+ * @brief A growable array of points stored on the heap.
+ * @details The buffer grows geometrically, doubling its capacity whenever it runs out of space. Therefore, appending
+ * points one-by-one only reallocates a logarithmic number of times.
+ */
+typedef struct PointBuffer {
+  /** @brief The points contained in the buffer. */
+  Point* elements;
+  /** @brief The number of points contained in the buffer. */
+  size_t count;
+  /**
+   * @brief The number of points the buffer can contain before it needs to grow.
+   * @private
+   */
+  size_t capacity;
+} PointBuffer;
+
+/**
+ * @brief Initializes a point buffer's elements, count, and capacity to their default values.
+ * @details This doesn't allocate. The buffer's elements are set to `NULL`, and its count and capacity to zero.
+ * @relates PointBuffer
+ * @param[in,out] buffer The point buffer to initialize.
+ */
+void create_point_buffer(PointBuffer* const buffer);
+
+/**
+ * @brief Ensures that a point buffer can contain a number of points without growing.
+ * @details This reallocates at most once. The new capacity is the larger of the requested capacity and double the
+ * current capacity.
+ * @relates PointBuffer
+ * @param[in,out] buffer The point buffer to grow.
+ * @param capacity The number of points the buffer should be able to contain.
+ * @return Whether the point buffer can contain the number of points.
+ */
+bool reserve_points(PointBuffer* const buffer, size_t capacity);
+
+/**
+ * @brief Adds a point to the end of a point buffer.
+ * @details This grows the buffer if it is full.
+ * @relates PointBuffer
+ * @param[in,out] buffer The point buffer to add to.
+ * @param point The point to add.
+ * @return Whether the point was added.
+ */
+bool append_point(PointBuffer* const buffer, Point point);
+
+/**
+ * @brief Frees the points of a point buffer.
+ * @details This resets the buffer to its default values, so it can be reused.
+ * @relates PointBuffer
+ * @param[in,out] buffer The point buffer to free.
+ */
+void destroy_point_buffer(PointBuffer* const buffer);
+
+#endif  // CONVEX_HULL_POINT_BUFFER_H_
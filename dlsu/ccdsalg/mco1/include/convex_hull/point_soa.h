@@ -0,0 +1,97 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file point_soa.h
+ * @brief The public APIs of the structure of arrays point layout and its helper functions.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_POINT_SOA_H_
+#define CONVEX_HULL_POINT_SOA_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "geometry.h"
+
+/**
+ * @brief Points stored as a structure of arrays, with the x-coordinates and y-coordinates in separate arrays.
+ * @details Unlike an array of `Point`, consecutive coordinates of the same axis are adjacent in memory, so they can be
+ * loaded into vector registers directly.
+ */
+typedef struct PointSoA {
+  /** @brief The x-coordinates of the points. */
+  double* x;
+  /** @brief The y-coordinates of the points. */
+  double* y;
+  /** @brief The number of points contained. */
+  size_t count;
+  /**
+   * @brief The number of points the arrays can contain before they need to grow.
+   * @private
+   */
+  size_t capacity;
+} PointSoA;
+
+/**
+ * @brief Initializes a structure of arrays' coordinates, count, and capacity to their default values.
+ * @details This doesn't allocate. The coordinate arrays are set to `NULL`, and the count and capacity to zero.
+ * @relates PointSoA
+ * @param[in,out] points The structure of arrays to initialize.
+ */
+void create_point_soa(PointSoA* const points);
+
+/**
+ * @brief Ensures that a structure of arrays can contain a number of points without growing.
+ * @relates PointSoA
+ * @param[in,out] points The structure of arrays to grow.
+ * @param capacity The number of points the structure of arrays should be able to contain.
+ * @return Whether the structure of arrays can contain the number of points.
+ */
+bool reserve_point_soa(PointSoA* const points, size_t capacity);
+
+/**
+ * @brief Replaces the contents of a structure of arrays with an array of points.
+ * @relates PointSoA
+ * @param[in,out] soa_points The structure of arrays to copy to.
+ * @param[in] points The points to copy from.
+ * @param point_count The number of points to copy.
+ * @return Whether the structure of arrays could be grown to contain the points.
+ */
+bool copy_points_to_soa(PointSoA* const soa_points, const Point* const points, size_t point_count);
+
+/**
+ * @brief Copies the contents of a structure of arrays into an array of points.
+ * @relates PointSoA
+ * @param[in] soa_points The structure of arrays to copy from.
+ * @param[out] points The array to copy to. This must be able to contain all of the points.
+ */
+void copy_points_from_soa(const PointSoA* const soa_points, Point* const points);
+
+/**
+ * @brief Frees the coordinates of a structure of arrays.
+ * @details This resets the structure of arrays to its default values, so it can be reused.
+ * @relates PointSoA
+ * @param[in,out] points The structure of arrays to free.
+ */
+void destroy_point_soa(PointSoA* const points);
+
+#endif  // CONVEX_HULL_POINT_SOA_H_
@@ -0,0 +1,77 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file quick_hull.h
+ * @brief The public APIs of the QuickHull implementation.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_QUICK_HULL_H_
+#define CONVEX_HULL_QUICK_HULL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "point_buffer.h"
+
+/** @brief The smallest number of points a subproblem needs to be given its own thread. */
+#define MIN_QUICK_HULL_TASK_SIZE 32768
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using the QuickHull algorithm.
+ * @details This is `parallel_quick_hull_in_place` with a single thread, which follows the `InPlaceScan` signature.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t quick_hull_in_place(Point* const points, size_t point_count);
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using the QuickHull algorithm
+ * and multiple threads.
+ * @details This locates the points with the lowest and highest x-coordinates, and y-coordinates if multiple, which
+ * split the points into those below and above the line between them. On each side, the point farthest from the line
+ * is part of the convex hull, and the points inside the triangle it forms with the line are discarded. The points
+ * outside of the triangle's two other sides are then partitioned in place into two subproblems, which are solved
+ * recursively. Subproblems of at least `MIN_QUICK_HULL_TASK_SIZE` points are given their own thread while threads
+ * remain. If a thread can't be created, its subproblem is solved by the calling thread instead. The points are in the
+ * same order as the Graham scans. This never allocates.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_count The number of points to scan.
+ * @param thread_count The maximum number of threads to scan with.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t parallel_quick_hull_in_place(Point* const points, size_t point_count, size_t thread_count);
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull using the QuickHull algorithm and
+ * multiple threads.
+ * @details This finds the convex hull with `parallel_quick_hull_in_place`, then copies it into the convex set's buffer.
+ * The convex set's buffer is only grown when it can't contain the convex hull, so reusing the same buffer across scans
+ * stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param[out] convex_points The points from the created convex set.
+ * @param thread_count The maximum number of threads to scan with.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool quick_hull(PointBuffer* const points, PointBuffer* const convex_points, size_t thread_count);
+
+#endif  // CONVEX_HULL_QUICK_HULL_H_
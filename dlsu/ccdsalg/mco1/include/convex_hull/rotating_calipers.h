@@ -0,0 +1,125 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file rotating_calipers.h
+ * @brief The public APIs of the rotating calipers that measure a convex hull.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_ROTATING_CALIPERS_H_
+#define CONVEX_HULL_ROTATING_CALIPERS_H_
+
+#include <stddef.h>
+
+#include "geometry.h"
+
+/** @brief The number of corners of a rectangle. */
+#define RECTANGLE_CORNER_COUNT 4
+
+/** @brief A line segment between two points. */
+typedef struct LineSegment {
+  /** @brief The first endpoint of the line segment. */
+  Point start;
+  /** @brief The second endpoint of the line segment. */
+  Point end;
+  /** @brief The distance between the endpoints. */
+  double length;
+} LineSegment;
+
+/** @brief A rectangle that can be rotated, unlike a bounding box. */
+typedef struct OrientedRectangle {
+  /** @brief The corners of the rectangle in counter-clockwise order. */
+  Point corners[RECTANGLE_CORNER_COUNT];
+  /** @brief The area of the rectangle. */
+  double area;
+  /** @brief The perimeter of the rectangle. */
+  double perimeter;
+} OrientedRectangle;
+
+/** @brief The measurements of a convex hull. */
+typedef struct HullMetrics {
+  /** @brief The farthest pair of points of the convex hull. */
+  LineSegment diameter;
+  /** @brief The shortest line segment between two parallel lines that enclose the convex hull. */
+  LineSegment width;
+  /** @brief The rectangle with the smallest area that encloses the convex hull. */
+  OrientedRectangle min_area_rectangle;
+  /** @brief The rectangle with the smallest perimeter that encloses the convex hull. */
+  OrientedRectangle min_perimeter_rectangle;
+} HullMetrics;
+
+/**
+ * @brief Locates the farthest pair of points of a convex hull.
+ * @details A pair of calipers is rotated around the convex hull, so only the `O(h)` antipodal pairs of points are
+ * compared instead of every pair. The points must be in the same order as the Graham scans, without collinear points.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_count The number of points from the convex set.
+ * @param[out] diameter The farthest pair of points, or a line segment of length zero if there are fewer than two.
+ */
+void find_hull_diameter(const Point* const convex_points, size_t convex_point_count, LineSegment* const diameter);
+
+/**
+ * @brief Calculates the width of a convex hull, the shortest distance between two parallel lines that enclose it.
+ * @details One of the lines always contains an edge of the convex hull, so a pair of calipers is rotated around the
+ * convex hull, and only the point farthest from each edge is measured, which takes `O(h)` time. The points must be in
+ * the same order as the Graham scans, without collinear points.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_count The number of points from the convex set.
+ * @param[out] width The line segment from the point farthest from the narrowest edge to its projection onto the edge,
+ * or a line segment of length zero if there are fewer than three points.
+ */
+void find_hull_width(const Point* const convex_points, size_t convex_point_count, LineSegment* const width);
+
+/**
+ * @brief Locates the rectangle with the smallest area that encloses a convex hull.
+ * @details One of the rectangle's sides always contains an edge of the convex hull, so four calipers are rotated around
+ * the convex hull, one per side, which takes `O(h)` time. The points must be in the same order as the Graham scans,
+ * without collinear points.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_count The number of points from the convex set.
+ * @param[out] rectangle The rectangle with the smallest area, which is flat if there are fewer than three points.
+ */
+void find_min_area_rectangle(const Point* const convex_points, size_t convex_point_count,
+                             OrientedRectangle* const rectangle);
+
+/**
+ * @brief Locates the rectangle with the smallest perimeter that encloses a convex hull.
+ * @details One of the rectangle's sides always contains an edge of the convex hull, so four calipers are rotated around
+ * the convex hull, one per side, which takes `O(h)` time. The points must be in the same order as the Graham scans,
+ * without collinear points.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_count The number of points from the convex set.
+ * @param[out] rectangle The rectangle with the smallest perimeter, which is flat if there are fewer than three points.
+ */
+void find_min_perimeter_rectangle(const Point* const convex_points, size_t convex_point_count,
+                                  OrientedRectangle* const rectangle);
+
+/**
+ * @brief Measures a convex hull.
+ * @details The calipers are rotated around the convex hull twice, once for the diameter and the width, and once for
+ * both rectangles, which is faster than finding each metric separately.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_count The number of points from the convex set.
+ * @param[out] metrics The measurements of the convex hull.
+ */
+void measure_hull(const Point* const convex_points, size_t convex_point_count, HullMetrics* const metrics);
+
+#endif  // CONVEX_HULL_ROTATING_CALIPERS_H_
@@ -0,0 +1,142 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file sliding_hull.h
+ * @brief The public APIs of the convex hull over a sliding window of a timestamped point stream.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef CONVEX_HULL_SLIDING_HULL_H_
+#define CONVEX_HULL_SLIDING_HULL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "dynamic_hull.h"
+#include "geometry.h"
+
+/** @brief The number of points a sliding window can contain after its first allocation. */
+#define MIN_SLIDING_WINDOW_CAPACITY 16
+
+/** @brief A point of a stream, along with the time it arrived at. */
+typedef struct TimedPoint {
+  /** @brief The time the point arrived at, in seconds. */
+  double time;
+  /** @brief The point itself. */
+  Point point;
+} TimedPoint;
+
+/**
+ * @brief A convex hull of the points of a stream that arrived within the last seconds, or of its last points.
+ * @details The window's points are kept in a ring buffer in the order they arrived, and the convex hull of the window
+ * is kept in a dynamic convex hull. A point entering the window is inserted into it, and a point leaving the window is
+ * removed from it, so sliding the window by one point takes `O(log^2 n)` amortized time instead of scanning the whole
+ * window again.
+ */
+typedef struct SlidingHull {
+  /**
+   * @brief The convex hull of the window's points.
+   * @private
+   */
+  DynamicHull hull;
+  /**
+   * @brief The ring buffer of the window's points, from the oldest to the newest.
+   * @private
+   */
+  TimedPoint* window;
+  /**
+   * @brief The index of the window's oldest point within the ring buffer.
+   * @private
+   */
+  size_t first;
+  /** @brief The number of points within the window. */
+  size_t count;
+  /**
+   * @brief The number of points the ring buffer can contain before it needs to grow.
+   * @private
+   */
+  size_t capacity;
+  /** @brief The number of seconds a point stays within the window, or zero if it isn't limited by time. */
+  double duration;
+  /** @brief The maximum number of points within the window, or zero if it isn't limited by count. */
+  size_t max_count;
+} SlidingHull;
+
+/**
+ * @brief Initializes a sliding convex hull to have an empty window.
+ * @details This doesn't allocate.
+ * @relates SlidingHull
+ * @param[in,out] hull The sliding convex hull to initialize.
+ * @param duration The number of seconds a point stays within the window, or zero if it isn't limited by time.
+ * @param max_count The maximum number of points within the window, or zero if it isn't limited by count.
+ */
+void create_sliding_hull(SlidingHull* const hull, double duration, size_t max_count);
+
+/**
+ * @brief Removes the points that left the window by a time.
+ * @details A point leaves the window once `duration` seconds have passed since it arrived. The points are assumed to
+ * arrive in order, so only the oldest points are checked.
+ * @relates SlidingHull
+ * @param[in,out] hull The sliding convex hull to update.
+ * @param time The current time, in seconds.
+ */
+void expire_sliding_hull_points(SlidingHull* const hull, double time);
+
+/**
+ * @brief Adds a point arriving at the end of the window.
+ * @details The points that left the window by the point's time are removed first, followed by the oldest point if the
+ * window is full. This takes `O(log^2 n)` amortized time per point added or removed.
+ * @relates SlidingHull
+ * @param[in,out] hull The sliding convex hull to add to.
+ * @param point The point to add.
+ * @return Whether the window could be grown to contain the point.
+ */
+bool push_sliding_hull_point(SlidingHull* const hull, TimedPoint point);
+
+/**
+ * @brief Gets the number of points that make up the convex hull of a window.
+ * @relates SlidingHull
+ * @param[in] hull The sliding convex hull to use.
+ * @return The number of points from the convex set.
+ */
+size_t get_sliding_hull_point_count(const SlidingHull* const hull);
+
+/**
+ * @brief Copies the points that make up the convex hull of a window into a caller-owned array.
+ * @details The points are in the same order as the Graham scans: counter-clockwise, starting from the point with the
+ * lowest y-coordinate, and lowest x-coordinate if multiple.
+ * @relates SlidingHull
+ * @param[in] hull The sliding convex hull to use.
+ * @param[out] convex_points The array to copy the points from the convex set to. This must be able to contain
+ * `get_sliding_hull_point_count` points.
+ * @return The number of points from the convex set.
+ */
+size_t copy_sliding_hull_points(const SlidingHull* const hull, Point* const convex_points);
+
+/**
+ * @brief Frees the window and the convex hull of a sliding convex hull.
+ * @details This empties the window, keeping its limits, so it can be reused.
+ * @relates SlidingHull
+ * @param[in,out] hull The sliding convex hull to free.
+ */
+void destroy_sliding_hull(SlidingHull* const hull);
+
+#endif  // CONVEX_HULL_SLIDING_HULL_H_
@@ -42,19 +42,22 @@ void swap(Point* const a, Point* const b);
 /**
  * @brief Sorts points by their polar angle or distance in ascending order using the selection sort algorithm.
  * @details This sorts points by their polar angles by default. If multiple points share a polar angle, this sorts those
- * by their distances.
+ * by their distances. The points are compared with `is_larger`, so nearly collinear points are never misordered.
  * @param[in,out] points The points to sort.
  * @param point_count The number of points to sort.
- * @param[in] anchor_point The anchor or origin point to use.
+ * @param[in] anchor_point The anchor or origin point to use. This must be the lowest point, like `find_anchor_point`'s.
  */
 void selection_sort(Point* const points, size_t point_count, const Point* const anchor_point);
 
 /**
  * @brief Checks if a point is larger than another point.
  * @details This checks if the polar angle is greater, or if the distance is greater when the polar angles are equal.
+ * Neither is rounded. The polar angles are compared with the exact orientation of the points around the anchor point.
+ * Points sharing a polar angle are on the same ray from the anchor point, so the farther point is the higher point, or
+ * the point further right if the ray is horizontal.
  * @param[in] a The point to check.
  * @param[in] b The point to check against.
- * @param[in] anchor_point The anchor or origin point to use.
+ * @param[in] anchor_point The anchor or origin point to use. This must be the lowest point, like `find_anchor_point`'s.
  * @return Whether point `a` is larger than point `b`.
  */
 bool is_larger(const Point* const a, const Point* const b, const Point* const anchor_point);
@@ -62,11 +65,54 @@ bool is_larger(const Point* const a, const Point* const b, const Point* const an
 /**
  * @brief Sorts points by their polar angle or distance in ascending order using the heap sort algorithm.
  * @details This sorts points by their polar angles by default. If multiple points share a polar angle, this sorts those
- * by their distances.
+ * by their distances. The points are compared with `is_larger`, so nearly collinear points are never misordered.
  * @param[in,out] points The points to sort.
  * @param point_count The number of points to sort.
- * @param[in] anchor_point The anchor or origin point to use.
+ * @param[in] anchor_point The anchor or origin point to use. This must be the lowest point, like `find_anchor_point`'s.
  */
 void heap_sort(Point* const points, size_t point_count, const Point* const anchor_point);
 
+/**
+ * @brief Checks if a point is lexicographically larger than another point.
+ * @details This checks if the x-coordinate is greater, or if the y-coordinate is greater when the x-coordinates are
+ * equal.
+ * @param[in] a The point to check.
+ * @param[in] b The point to check against.
+ * @return Whether point `a` is lexicographically larger than point `b`.
+ */
+bool is_lexicographically_larger(const Point* const a, const Point* const b);
+
+/**
+ * @brief Sorts points by their x-coordinate or y-coordinate in ascending order using the heap sort algorithm.
+ * @details This sorts points by their x-coordinates by default. If multiple points share an x-coordinate, this sorts
+ * those by their y-coordinates. Unlike `heap_sort`, this needs no anchor point.
+ * @param[in,out] points The points to sort.
+ * @param point_count The number of points to sort.
+ */
+void lexicographic_sort(Point* const points, size_t point_count);
+
+/**
+ * @brief Sorts points by their x-coordinate or y-coordinate in ascending order using the insertion sort algorithm.
+ * @details This sorts points like `lexicographic_sort`, but is faster for a few dozen points, since it has no heap to
+ * build and moves each point only past the larger points before it.
+ * @param[in,out] points The points to sort.
+ * @param point_count The number of points to sort.
+ */
+void lexicographic_insertion_sort(Point* const points, size_t point_count);
+
+/**
+ * @brief Sorts points by their polar angle or distance in ascending order using the radix sort algorithm.
+ * @details This sorts points by their polar angles by default. If multiple points share a polar angle, this sorts those
+ * by their distances. Instead of comparing points, each point's pseudo-angle and squared distance are calculated once
+ * and stored with it. The records are then sorted by the bits of their keys, least significant first, and the points
+ * are copied back in order. Passes where every record has the same digit are skipped. The pseudo-angles are rounded,
+ * so every run of points whose pseudo-angles are within their rounding error of each other is sorted again with
+ * `heap_sort`, which compares them exactly.
+ * @param[in,out] points The points to sort.
+ * @param point_count The number of points to sort.
+ * @param[in] anchor_point The anchor or origin point to use. This must be the lowest point, like `find_anchor_point`'s.
+ * @return Whether the memory for the records could be allocated. The points are left unsorted if not.
+ */
+bool radix_sort(Point* const points, size_t point_count, const Point* const anchor_point);
+
 #endif  // CONVEX_HULL_SORT_H_
@@ -36,33 +36,39 @@ extern "C" {
 
 #include "geometry.h"
 
-/** @brief The maximum number of elements a stack can contain. */
-#define MAX_STACK_SIZE 32768
-
 /**
  * @brief A collection implementing the [stack data structure](https://www.geeksforgeeks.org/dsa/stack-data-structure/)
  * using an array.
+ * @details The stack doesn't own its array. The array is supplied when the stack is initialized, so it can live on the
+ * heap and be as large as the points being scanned.
  */
 typedef struct Stack {
   /**
    * @brief The ordered elements contained in the stack.
    * @private
    */
-  Point elements[MAX_STACK_SIZE];
+  Point* elements;
   /**
    * @brief The index of the element at the top of the stack.
    * @private
    */
   size_t top;
+  /**
+   * @brief The maximum number of elements the stack can contain.
+   * @private
+   */
+  size_t capacity;
 } Stack;
 
 /**
- * @brief Initializes a stack's elements and top index to their default values.
+ * @brief Initializes a stack's elements, top index, and capacity to their default values.
  * @details This sets the stack's top index to `SIZE_MAX`.
  * @relates Stack
  * @param[in,out] stack The stack to initialize.
+ * @param[in] elements The array to store the stack's elements in.
+ * @param capacity The number of elements the array can contain.
  */
-void create(Stack* const stack);
+void create(Stack* const stack, Point* const elements, size_t capacity);
 
 /**
  * @brief Adds an element into the top of a stack.
@@ -102,7 +108,7 @@ const Point* next_to_top(Stack* const stack);
 
 /**
  * @brief Checks if a stack contains the maximum number of elements.
- * @details This checks if the stack's top index is one less than `MAX_STACK_SIZE` (`MAX_STACK_SIZE - 1`).
+ * @details This checks if the stack's top index is one less than its capacity (`capacity - 1`).
  * @relates Stack
  * @param[in] stack The stack to check.
  * @return Whether the stack contains the maximum number of elements.
@@ -0,0 +1,208 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/approximate_hull.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "convex_hull/graham_scan2.h"
+#include "convex_hull/monotone_chain.h"
+#include "convex_hull/sort.h"
+
+/** @brief The number of points kept from the leftmost or the rightmost points, the lowest and the highest. */
+#define EXTREME_POINT_COUNT 2
+
+/** @brief The number of points kept from every strip, the lowest and the highest. */
+#define STRIP_POINT_COUNT 2
+
+/**
+ * @brief Scans points to find an approximate convex hull in place with the Bentley-Faust-Preparata algorithm.
+ * @details This is `approximate_hull_in_place_with_strips` with `DEFAULT_APPROXIMATE_STRIP_COUNT` strips, which follows
+ * the `InPlaceScan` signature.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t approximate_hull_in_place(Point* const points, const size_t point_cnt) {
+  double error_bound;
+
+  return approximate_hull_in_place_with_strips(points, point_cnt, DEFAULT_APPROXIMATE_STRIP_COUNT, &error_bound);
+}
+
+/**
+ * @brief Scans points to find an approximate convex hull in place with the Bentley-Faust-Preparata algorithm.
+ * @details The points are split into vertical strips of equal widths, and only the lowest and the highest points of
+ * every strip are kept, along with the lowest and the highest of the leftmost and the rightmost points. The strips are
+ * already in order, so the kept points are sorted by sorting each strip's few points, and the monotone chain scan finds
+ * their convex hull. This takes `O(n + k)` time. The approximate convex hull is made of the given points, so it is
+ * inside the exact convex hull, and every point outside of it is at most one strip's width away from it. The points are
+ * in the same order as the Graham scans. If the strips can't be allocated, or there are too few points to be worth
+ * approximating, this finds the exact convex hull with the faster Graham scan instead.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @param strip_cnt The number of strips to split the points into. Zero is treated as one.
+ * @param[out] error_bound The largest distance of a point outside the approximate convex hull from it, or zero if the
+ * convex hull is exact.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t approximate_hull_in_place_with_strips(Point* const points, const size_t point_cnt, size_t strip_cnt,
+                                             double* const error_bound) {
+  *error_bound = 0;
+
+  if (strip_cnt == 0) {
+    strip_cnt = 1;
+  }
+
+  // approximating doesn't discard any points unless there are more points than can be kept
+  if (strip_cnt > point_cnt / STRIP_POINT_COUNT) {
+    return fast_scan_in_place(points, point_cnt);
+  }
+
+  const size_t max_kept_point_cnt = strip_cnt * STRIP_POINT_COUNT + 2 * EXTREME_POINT_COUNT;
+
+  if (point_cnt <= max_kept_point_cnt) {
+    return fast_scan_in_place(points, point_cnt);
+  }
+
+  Point* const strip_points = malloc((strip_cnt * STRIP_POINT_COUNT + max_kept_point_cnt) * sizeof(Point));
+
+  if (!strip_points) {
+    return fast_scan_in_place(points, point_cnt);
+  }
+
+  Point* const lowest_points = strip_points;
+  Point* const highest_points = &strip_points[strip_cnt];
+  Point* const kept_points = &strip_points[2 * strip_cnt];
+  const Point* leftmost_points[EXTREME_POINT_COUNT] = {&points[0], &points[0]};
+  const Point* rightmost_points[EXTREME_POINT_COUNT] = {&points[0], &points[0]};
+
+  for (size_t i = 1; i < point_cnt; i++) {
+    const Point* const point = &points[i];
+
+    if (point->x < leftmost_points[0]->x || (point->x == leftmost_points[0]->x && point->y < leftmost_points[0]->y)) {
+      leftmost_points[0] = point;
+    }
+
+    if (point->x < leftmost_points[1]->x || (point->x == leftmost_points[1]->x && point->y > leftmost_points[1]->y)) {
+      leftmost_points[1] = point;
+    }
+
+    if (point->x > rightmost_points[0]->x ||
+        (point->x == rightmost_points[0]->x && point->y < rightmost_points[0]->y)) {
+      rightmost_points[0] = point;
+    }
+
+    if (point->x > rightmost_points[1]->x ||
+        (point->x == rightmost_points[1]->x && point->y > rightmost_points[1]->y)) {
+      rightmost_points[1] = point;
+    }
+  }
+
+  const double min_x = leftmost_points[0]->x;
+  const double width = rightmost_points[0]->x - min_x;
+
+  // an empty strip has its lowest point above its highest point
+  for (size_t i = 0; i < strip_cnt; i++) {
+    lowest_points[i].y = INFINITY;
+    highest_points[i].y = -INFINITY;
+  }
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    const Point* const point = &points[i];
+    size_t strip_idx = width > 0 ? (size_t)((point->x - min_x) / width * (double)strip_cnt) : 0;
+
+    if (strip_idx >= strip_cnt) {
+      strip_idx = strip_cnt - 1;
+    }
+
+    if (point->y < lowest_points[strip_idx].y) {
+      lowest_points[strip_idx] = *point;
+    }
+
+    if (point->y > highest_points[strip_idx].y) {
+      highest_points[strip_idx] = *point;
+    }
+  }
+
+  // the strips are ordered by their x-coordinates, so sorting each strip's points sorts all of them
+  size_t kept_point_cnt = 0;
+
+  for (size_t i = 0; i < strip_cnt; i++) {
+    Point* const strip_kept_points = &kept_points[kept_point_cnt];
+    size_t strip_kept_point_cnt = 0;
+
+    if (i == 0) {
+      strip_kept_points[strip_kept_point_cnt++] = *leftmost_points[0];
+      strip_kept_points[strip_kept_point_cnt++] = *leftmost_points[1];
+    }
+
+    if (lowest_points[i].y <= highest_points[i].y) {
+      strip_kept_points[strip_kept_point_cnt++] = lowest_points[i];
+      strip_kept_points[strip_kept_point_cnt++] = highest_points[i];
+    }
+
+    if (i == strip_cnt - 1) {
+      strip_kept_points[strip_kept_point_cnt++] = *rightmost_points[0];
+      strip_kept_points[strip_kept_point_cnt++] = *rightmost_points[1];
+    }
+
+    lexicographic_insertion_sort(strip_kept_points, strip_kept_point_cnt);
+    kept_point_cnt += strip_kept_point_cnt;
+  }
+
+  size_t convex_point_cnt;
+
+  monotone_chain_scan_sorted_into(kept_points, kept_point_cnt, points, point_cnt, &convex_point_cnt);
+  free(strip_points);
+
+  *error_bound = width / (double)strip_cnt;
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Scans points to find an approximate convex hull with the Bentley-Faust-Preparata algorithm.
+ * @details This finds the convex hull with `approximate_hull_in_place_with_strips`, then copies it into the convex
+ * set's buffer. The convex set's buffer is only grown when it can't contain the convex hull, so reusing the same buffer
+ * across scans stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param[out] convex_points The points from the created convex set.
+ * @param strip_cnt The number of strips to split the points into. Zero is treated as one.
+ * @param[out] error_bound The largest distance of a point outside the approximate convex hull from it, or zero if the
+ * convex hull is exact.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool approximate_hull(PointBuffer* const points, PointBuffer* const convex_points, const size_t strip_cnt,
+                      double* const error_bound) {
+  const size_t convex_point_cnt =
+      approximate_hull_in_place_with_strips(points->elements, points->count, strip_cnt, error_bound);
+
+  if (!reserve_points(convex_points, convex_point_cnt)) {
+    return false;
+  }
+
+  if (convex_point_cnt > 0) {
+    memcpy(convex_points->elements, points->elements, convex_point_cnt * sizeof(Point));
+  }
+
+  convex_points->count = convex_point_cnt;
+
+  return true;
+}
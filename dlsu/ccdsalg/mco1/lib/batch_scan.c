@@ -0,0 +1,224 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/batch_scan.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "convex_hull/monotone_chain.h"
+#include "convex_hull/sort.h"
+
+/** @brief A run of groups to be scanned by a thread. */
+typedef struct BatchTask {
+  /** @brief The points of every group. */
+  const Point* points;
+  /** @brief The index of the first point of each group, followed by the total number of points. */
+  const size_t* offsets;
+  /** @brief The index of the run's first group. */
+  size_t first_group;
+  /** @brief The index after the run's last group. */
+  size_t last_group;
+  /** @brief The array to write the points from the created convex sets to. */
+  Point* convex_points;
+  /** @brief The index of the first point of each group's convex set. */
+  size_t* convex_offsets;
+  /** @brief The number of points from the run's convex sets, written from the run's first point onwards. */
+  size_t convex_point_count;
+  /** @brief Whether the run's scratch array could be allocated. */
+  bool is_scanned;
+  /** @brief The thread scanning the run. */
+  pthread_t thread;
+  /** @brief Whether the run is scanned by its own thread, instead of the calling thread. */
+  bool is_threaded;
+} BatchTask;
+
+/**
+ * @brief Scans the groups within a batch task's run.
+ * @details The convex sets are written back-to-back from the run's first point onwards. Every convex set has at most as
+ * many points as its group, so a convex set never overwrites the space of a later group. This is the entry point of the
+ * scanning threads.
+ * @param[in,out] task The batch task to run.
+ * @return Always `NULL`.
+ */
+static void* run_batch_task(void* const task) {
+  BatchTask* const batch_task = task;
+  const size_t* const offsets = batch_task->offsets;
+  size_t max_group_size = 0;
+
+  for (size_t i = batch_task->first_group; i < batch_task->last_group; i++) {
+    const size_t group_size = offsets[i + 1] - offsets[i];
+
+    max_group_size = group_size > max_group_size ? group_size : max_group_size;
+  }
+
+  Point* const group_points = max_group_size > 0 ? malloc(max_group_size * sizeof(Point)) : NULL;
+  size_t convex_point_idx = offsets[batch_task->first_group];
+
+  batch_task->is_scanned = max_group_size == 0 || group_points;
+
+  for (size_t i = batch_task->first_group; i < batch_task->last_group && batch_task->is_scanned; i++) {
+    const size_t group_size = offsets[i + 1] - offsets[i];
+    size_t convex_point_cnt = 0;
+
+    if (group_size > 0) {
+      memcpy(group_points, &batch_task->points[offsets[i]], group_size * sizeof(Point));
+
+      if (group_size <= MAX_INSERTION_SORT_GROUP_SIZE) {
+        lexicographic_insertion_sort(group_points, group_size);
+      } else {
+        lexicographic_sort(group_points, group_size);
+      }
+
+      monotone_chain_scan_sorted_into(group_points, group_size, &batch_task->convex_points[convex_point_idx],
+                                      group_size, &convex_point_cnt);
+    }
+
+    batch_task->convex_offsets[i] = convex_point_idx;
+    convex_point_idx += convex_point_cnt;
+  }
+
+  batch_task->convex_point_count = convex_point_idx - offsets[batch_task->first_group];
+
+  free(group_points);
+
+  return NULL;
+}
+
+/**
+ * @brief Locates the first group that starts at or after a point.
+ * @param[in] offsets The index of the first point of each group, followed by the total number of points.
+ * @param group_cnt The number of groups.
+ * @param point_idx The index of the point.
+ * @return The index of the group, or `group_cnt` if every group starts before the point.
+ */
+static size_t find_group(const size_t* const offsets, const size_t group_cnt, const size_t point_idx) {
+  size_t low_idx = 0;
+  size_t high_idx = group_cnt;
+
+  while (low_idx < high_idx) {
+    const size_t middle_idx = low_idx + (high_idx - low_idx) / 2;
+
+    if (offsets[middle_idx] < point_idx) {
+      low_idx = middle_idx + 1;
+    } else {
+      high_idx = middle_idx;
+    }
+  }
+
+  return low_idx;
+}
+
+/**
+ * @brief Scans many groups of points to find the points that would make up each group's convex hull.
+ * @details The groups are stored back-to-back in a single array, where group `i` is the points from `offsets[i]` up to
+ * `offsets[i + 1]`. Each group is copied into a reused scratch array, sorted by its x-coordinates, and y-coordinates if
+ * multiple, and scanned with Andrew's monotone chain algorithm. Groups of up to `MAX_INSERTION_SORT_GROUP_SIZE` points
+ * are sorted with the insertion sort algorithm, and larger groups with the heap sort algorithm. The convex hulls are
+ * written back-to-back in the same order as the groups, each in the same order as the Graham scans. The groups are
+ * split into contiguous runs of about the same number of points, one per thread, but no thread scans fewer than
+ * `MIN_BATCH_TASK_SIZE` points. If a thread can't be created, its run is scanned by the calling thread instead.
+ * @param[in] points The points of every group.
+ * @param[in] offsets The index of the first point of each group, followed by the total number of points. This must
+ * start with zero and never decrease.
+ * @param group_cnt The number of groups to scan.
+ * @param[out] convex_points The array to write the points from the created convex sets to. This must be able to contain
+ * `offsets[group_cnt]` points.
+ * @param[out] convex_offsets The index of the first point of each group's convex set, followed by the total number of
+ * points from the convex sets. This must be able to contain `group_cnt + 1` indices.
+ * @param thread_cnt The maximum number of threads to scan with.
+ * @return Whether the scratch arrays could be allocated. If not, the groups of the runs that couldn't be scanned are
+ * left with empty convex sets.
+ */
+bool batch_scan(const Point* const points, const size_t* const offsets, const size_t group_cnt,
+                Point* const convex_points, size_t* const convex_offsets, const size_t thread_cnt) {
+  const size_t point_cnt = offsets[group_cnt];
+  const size_t max_task_cnt = point_cnt / MIN_BATCH_TASK_SIZE;
+  size_t task_cnt = thread_cnt < max_task_cnt ? thread_cnt : max_task_cnt;
+
+  task_cnt = task_cnt > 0 ? task_cnt : 1;
+
+  BatchTask single_task;
+  BatchTask* const tasks = task_cnt > 1 ? malloc(task_cnt * sizeof(BatchTask)) : &single_task;
+
+  if (!tasks) {
+    return batch_scan(points, offsets, group_cnt, convex_points, convex_offsets, 1);
+  }
+
+  for (size_t i = 0; i < task_cnt; i++) {
+    BatchTask* const task = &tasks[i];
+
+    // every run ends at the first group starting after its share of the points, so the runs have similar sizes
+    task->points = points;
+    task->offsets = offsets;
+    task->first_group = i == 0 ? 0 : tasks[i - 1].last_group;
+    task->last_group = i + 1 < task_cnt ? find_group(offsets, group_cnt, point_cnt / task_cnt * (i + 1)) : group_cnt;
+    task->convex_points = convex_points;
+    task->convex_offsets = convex_offsets;
+    task->convex_point_count = 0;
+    task->is_scanned = false;
+    task->is_threaded = task_cnt > 1 && pthread_create(&task->thread, NULL, run_batch_task, task) == 0;
+
+    if (!task->is_threaded) {
+      run_batch_task(task);
+    }
+  }
+
+  for (size_t i = 0; i < task_cnt; i++) {
+    if (tasks[i].is_threaded) {
+      pthread_join(tasks[i].thread, NULL);
+    }
+  }
+
+  bool is_scanned = true;
+  size_t merged_point_cnt = 0;
+
+  for (size_t i = 0; i < task_cnt; i++) {
+    const BatchTask* const task = &tasks[i];
+    const size_t run_start_idx = offsets[task->first_group];
+
+    // a run whose scratch array couldn't be allocated never wrote the offsets of its groups
+    if (!task->is_scanned) {
+      for (size_t j = task->first_group; j < task->last_group; j++) {
+        convex_offsets[j] = merged_point_cnt;
+      }
+
+      is_scanned = false;
+
+      continue;
+    }
+
+    // every run starts at or after the merged points, so moving them forward never overwrites a later run
+    memmove(&convex_points[merged_point_cnt], &convex_points[run_start_idx], task->convex_point_count * sizeof(Point));
+
+    for (size_t j = task->first_group; j < task->last_group; j++) {
+      convex_offsets[j] -= run_start_idx - merged_point_cnt;
+    }
+
+    merged_point_cnt += task->convex_point_count;
+  }
+
+  convex_offsets[group_cnt] = merged_point_cnt;
+
+  if (tasks != &single_task) {
+    free(tasks);
+  }
+
+  return is_scanned;
+}
@@ -0,0 +1,365 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/chan_scan.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "convex_hull/graham_scan.h"
+#include "convex_hull/graham_scan2.h"
+#include "convex_hull/monotone_chain.h"
+
+/** @brief The convex hull of a group of points, in counter-clockwise order. */
+typedef struct ChanGroup {
+  /** @brief The points of the group's convex hull. */
+  const Point* points;
+  /** @brief The number of points of the group's convex hull. */
+  size_t point_count;
+} ChanGroup;
+
+/**
+ * @brief Checks if two points have the same coordinates.
+ * @param[in] a The point to check.
+ * @param[in] b The point to check against.
+ * @return Whether both points have the same coordinates.
+ */
+static bool is_same_point(const Point* const a, const Point* const b) {
+  return a->x == b->x && a->y == b->y;
+}
+
+/**
+ * @brief Checks if a candidate point is a better next point of a Jarvis march than the current one.
+ * @details The better point is the more clockwise as seen from the last point, so every other point is on its left. If
+ * both are in the same direction, the farther point is better, since the nearer one is collinear.
+ * @param[in] last_point The last point of the convex hull.
+ * @param[in] current_point The current next point, or `NULL` if there is none yet.
+ * @param[in] candidate_point The candidate next point.
+ * @return Whether the candidate point is better.
+ */
+static bool is_better_next_point(const Point* const last_point, const Point* const current_point,
+                                 const Point* const candidate_point) {
+  if (is_same_point(candidate_point, last_point)) {
+    return false;
+  }
+
+  if (!current_point) {
+    return true;
+  }
+
+  const int direction = orientation(last_point, current_point, candidate_point);
+
+  if (direction != 0) {
+    return direction < 0;
+  }
+
+  return squared_distance(last_point, candidate_point) > squared_distance(last_point, current_point);
+}
+
+/**
+ * @brief Checks if an edge of a group's convex hull faces a point, or is collinear with it.
+ * @param[in] group The group to check.
+ * @param[in] point The point outside of the group's convex hull.
+ * @param edge_idx The index of the edge's first vertex.
+ * @return Whether the point is on the right of or on the line through the edge.
+ */
+static bool is_facing_edge(const ChanGroup* const group, const Point* const point, const size_t edge_idx) {
+  const Point* const vertices = group->points;
+  const size_t vertex_cnt = group->point_count;
+
+  return orientation(&vertices[edge_idx], &vertices[(edge_idx + 1) % vertex_cnt], point) <= 0;
+}
+
+/**
+ * @brief Locates the last vertex of a group's convex hull that is not clockwise of a direction around its first vertex.
+ * @details The vertices after the first are sorted by their angles around it, so this is a binary search. The direction
+ * is the one from the first vertex to the point, or the opposite one if reversed, and it must not be clockwise of the
+ * second vertex.
+ * @param[in] group The group to search. This must have at least three points.
+ * @param[in] point The point the direction is taken from.
+ * @param is_reversed Whether the direction is the opposite one.
+ * @return The index of the vertex, between the second and the second-to-last vertices.
+ */
+static size_t search_fan(const ChanGroup* const group, const Point* const point, const bool is_reversed) {
+  const Point* const vertices = group->points;
+  size_t low_idx = 1;
+  size_t high_idx = group->point_count - 2;
+
+  while (low_idx < high_idx) {
+    const size_t middle_idx = high_idx - (high_idx - low_idx) / 2;
+    const int direction = orientation(&vertices[0], &vertices[middle_idx], point);
+
+    if (is_reversed ? direction <= 0 : direction >= 0) {
+      low_idx = middle_idx;
+    } else {
+      high_idx = middle_idx - 1;
+    }
+  }
+
+  return low_idx;
+}
+
+/**
+ * @brief Locates a point among the vertices of a group's convex hull with a binary search.
+ * @param[in] group The group to search. This must have at least three points.
+ * @param[in] point The point to locate.
+ * @param[out] vertex_idx The index of the vertex equal to the point, if there is one.
+ * @return Whether the point is a vertex of the group's convex hull.
+ */
+static bool search_vertex(const ChanGroup* const group, const Point* const point, size_t* const vertex_idx) {
+  const Point* const vertices = group->points;
+
+  if (is_same_point(&vertices[0], point)) {
+    *vertex_idx = 0;
+
+    return true;
+  }
+
+  // a vertex is never clockwise of the second vertex, so the fan search finds it or the vertex before it
+  const size_t fan_idx = search_fan(group, point, false);
+
+  for (size_t i = fan_idx; i <= fan_idx + 1; i++) {
+    if (is_same_point(&vertices[i], point)) {
+      *vertex_idx = i;
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Locates the tangent point from a point outside of a group's convex hull with a binary search.
+ * @details The tangent point is the vertex where every point of the group's convex hull is on the left of or on the
+ * line from the point to it. The edges facing the point are consecutive, and the tangent point ends the last of them,
+ * so an edge facing the point and a later edge facing away from it are located first. The point is either inside the
+ * angle at the first vertex, where the fan search finds a facing edge, or its opposite direction is, where the fan
+ * search finds an edge facing away. Otherwise, the first or the last edge already is one. The last facing edge between
+ * them is then located with a binary search.
+ * @param[in] group The group to search. This must have at least three points.
+ * @param[in] point The point outside of the group's convex hull, which must not be one of its vertices.
+ * @return The index of the tangent point.
+ */
+static size_t search_tangent(const ChanGroup* const group, const Point* const point) {
+  const size_t vertex_cnt = group->point_count;
+  const bool is_first_edge_facing = is_facing_edge(group, point, 0);
+  const bool is_last_edge_facing = is_facing_edge(group, point, vertex_cnt - 1);
+
+  if (!is_first_edge_facing && is_last_edge_facing) {
+    return 0;
+  }
+
+  size_t facing_idx = 0;
+  size_t away_idx = vertex_cnt - 1;
+
+  if (!is_first_edge_facing) {
+    facing_idx = search_fan(group, point, false);
+    away_idx = vertex_cnt;
+  } else if (is_last_edge_facing) {
+    away_idx = search_fan(group, point, true);
+  }
+
+  while (away_idx - facing_idx > 1) {
+    const size_t middle_idx = facing_idx + (away_idx - facing_idx) / 2;
+
+    if (is_facing_edge(group, point, middle_idx)) {
+      facing_idx = middle_idx;
+    } else {
+      away_idx = middle_idx;
+    }
+  }
+
+  return away_idx % vertex_cnt;
+}
+
+/**
+ * @brief Locates the best next point of a Jarvis march within a group.
+ * @details If the last point is a vertex of the group's convex hull, the vertex after it is the tangent point.
+ * Otherwise, the tangent point is located with a binary search. The search then walks to a neighbor for as long as it
+ * is a better next point, so a collinear farther vertex, or a run of collinear vertices, replaces the tangent point.
+ * Groups of fewer than three points have no edges to search, so their points are compared directly.
+ * @param[in] group The group to search.
+ * @param[in] last_point The last point of the convex hull.
+ * @return The best next point within the group, or `NULL` if every point of the group is equal to the last point.
+ */
+static const Point* find_group_next_point(const ChanGroup* const group, const Point* const last_point) {
+  const Point* const vertices = group->points;
+  const size_t vertex_cnt = group->point_count;
+
+  if (vertex_cnt < 3) {
+    const Point* next_point = NULL;
+
+    for (size_t i = 0; i < vertex_cnt; i++) {
+      if (is_better_next_point(last_point, next_point, &vertices[i])) {
+        next_point = &vertices[i];
+      }
+    }
+
+    return next_point;
+  }
+
+  size_t vertex_idx;
+  size_t tangent_idx = search_vertex(group, last_point, &vertex_idx) ? (vertex_idx + 1) % vertex_cnt
+                                                                    : search_tangent(group, last_point);
+
+  // every step is strictly better, so neither walk can cycle
+  while (is_better_next_point(last_point, &vertices[tangent_idx], &vertices[(tangent_idx + 1) % vertex_cnt])) {
+    tangent_idx = (tangent_idx + 1) % vertex_cnt;
+  }
+
+  while (is_better_next_point(last_point, &vertices[tangent_idx],
+                              &vertices[(tangent_idx + vertex_cnt - 1) % vertex_cnt])) {
+    tangent_idx = (tangent_idx + vertex_cnt - 1) % vertex_cnt;
+  }
+
+  return &vertices[tangent_idx];
+}
+
+/**
+ * @brief Wraps the convex hull of the groups' convex hulls like a Jarvis march.
+ * @param[in] groups The groups to wrap.
+ * @param group_cnt The number of groups to wrap.
+ * @param[in] anchor_point The anchor point to start wrapping from.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @return The number of points from the created convex set, or `SIZE_MAX` if it doesn't fit into the array.
+ */
+static size_t wrap_groups(const ChanGroup* const groups, const size_t group_cnt, const Point* const anchor_point,
+                          Point* const convex_points, const size_t convex_point_capacity) {
+  size_t convex_point_cnt = 0;
+  Point last_point = *anchor_point;
+
+  while (convex_point_cnt < convex_point_capacity) {
+    convex_points[convex_point_cnt++] = last_point;
+
+    const Point* next_point = NULL;
+
+    for (size_t i = 0; i < group_cnt; i++) {
+      const Point* const group_next_point = find_group_next_point(&groups[i], &last_point);
+
+      if (group_next_point && is_better_next_point(&last_point, next_point, group_next_point)) {
+        next_point = group_next_point;
+      }
+    }
+
+    if (!next_point || is_same_point(next_point, anchor_point)) {
+      return convex_point_cnt;
+    }
+
+    last_point = *next_point;
+  }
+
+  return SIZE_MAX;
+}
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using Chan's algorithm.
+ * @details The points are split into groups of `m` points, and the convex hull of each group is found with the monotone
+ * chain, which never keeps collinear points, so the tangent searches can rely on each group being strictly convex. The
+ * wrapping's array doubles as the monotone chain's stack until the wrapping starts. Starting from the anchor point, the
+ * convex hull is then wrapped like a Jarvis march, where the next point is the most clockwise of every group's tangent,
+ * each located by a binary search. If the convex hull has more than `m` points, the wrapping is stopped and the round
+ * is repeated with `m` squared. Every point of the convex hull is also a point of its group's convex hull, so each
+ * round only keeps the points of the previous round's group convex hulls. This takes `O(n log h)` time, which is faster
+ * than the Graham scans when the convex hull is small. If the wrapping can't be allocated, this falls back to the
+ * faster Graham scan.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t chan_scan_in_place(Point* const points, size_t point_cnt) {
+  size_t group_size = MIN_CHAN_GROUP_SIZE;
+
+  while (group_size < point_cnt) {
+    const size_t group_cnt = (point_cnt + group_size - 1) / group_size;
+    ChanGroup* const groups = malloc(group_cnt * sizeof(ChanGroup));
+    Point* const convex_points = malloc(group_size * sizeof(Point));
+
+    if (!groups || !convex_points) {
+      free(groups);
+      free(convex_points);
+
+      break;
+    }
+
+    size_t group_point_cnt = 0;
+
+    for (size_t i = 0; i < group_cnt; i++) {
+      Point* const group_points = &points[i * group_size];
+      size_t group_hull_cnt;
+
+      // a group never has more than `group_size` points, so its convex hull always fits
+      monotone_chain_scan_into(group_points, i + 1 < group_cnt ? group_size : point_cnt - i * group_size,
+                               convex_points, group_size, &group_hull_cnt);
+
+      // every group starts at or after the kept points, so copying them forward never overwrites a later group
+      memcpy(&points[group_point_cnt], convex_points, group_hull_cnt * sizeof(Point));
+
+      groups[i].points = &points[group_point_cnt];
+      groups[i].point_count = group_hull_cnt;
+      group_point_cnt += group_hull_cnt;
+    }
+
+    point_cnt = group_point_cnt;
+
+    const Point anchor_point = find_anchor_point(points, point_cnt);
+    const size_t convex_point_cnt = wrap_groups(groups, group_cnt, &anchor_point, convex_points, group_size);
+
+    if (convex_point_cnt != SIZE_MAX) {
+      memcpy(points, convex_points, convex_point_cnt * sizeof(Point));
+    }
+
+    free(groups);
+    free(convex_points);
+
+    if (convex_point_cnt != SIZE_MAX) {
+      return convex_point_cnt;
+    }
+
+    group_size = group_size > SIZE_MAX / group_size ? SIZE_MAX : group_size * group_size;
+  }
+
+  return fast_scan_in_place(points, point_cnt);
+}
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull using Chan's algorithm.
+ * @details This finds the convex hull with `chan_scan_in_place`, then copies it into the convex set's buffer. The
+ * convex set's buffer is only grown when it can't contain the convex hull, so reusing the same buffer across scans
+ * stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param[out] convex_points The points from the created convex set.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool chan_scan(PointBuffer* const points, PointBuffer* const convex_points) {
+  const size_t convex_point_cnt = chan_scan_in_place(points->elements, points->count);
+
+  if (!reserve_points(convex_points, convex_point_cnt)) {
+    return false;
+  }
+
+  if (convex_point_cnt > 0) {
+    memcpy(convex_points->elements, points->elements, convex_point_cnt * sizeof(Point));
+  }
+
+  convex_points->count = convex_point_cnt;
+
+  return true;
+}
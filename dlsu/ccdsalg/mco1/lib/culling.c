@@ -0,0 +1,228 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/culling.h"
+
+#include <stdbool.h>
+
+#include "convex_hull/kernels.h"
+
+/** @brief The number of points checked at a time by the structure of arrays culling. */
+#define CULLING_BLOCK_SIZE 1024
+
+/**
+ * @brief Checks if a point is strictly inside a convex polygon.
+ * @details The polygon's vertices must be in counter-clockwise order without repeated vertices.
+ * @param[in] point The point to check.
+ * @param[in] vertices The vertices of the polygon.
+ * @param vertex_cnt The number of vertices of the polygon.
+ * @return Whether the point is to the left of every edge of the polygon.
+ */
+static bool is_strictly_inside(const Point* const point, const Point* const vertices, const size_t vertex_cnt) {
+  for (size_t i = 0; i < vertex_cnt; i++) {
+    const Point* const edge_start = &vertices[i];
+    const Point* const edge_end = &vertices[(i + 1) % vertex_cnt];
+
+    if (orientation(edge_start, edge_end, point) <= 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Creates the convex polygon formed by the extreme points.
+ * @details With four directions, only the axis-aligned extreme points are used. Repeated vertices are removed, since
+ * they don't form an edge.
+ * @param[in] extreme_points The extreme points in each direction, in counter-clockwise order starting from the bottom.
+ * @param direction_cnt The number of directions to use, either `QUADRILATERAL_DIRECTION_COUNT` or
+ * `OCTAGON_DIRECTION_COUNT`.
+ * @param[out] vertices The vertices of the polygon.
+ * @return The number of vertices of the polygon.
+ */
+static size_t create_extreme_polygon(const Point extreme_points[OCTAGON_DIRECTION_COUNT], const size_t direction_cnt,
+                                     Point vertices[OCTAGON_DIRECTION_COUNT]) {
+  const size_t direction_step = direction_cnt == QUADRILATERAL_DIRECTION_COUNT ? 2 : 1;
+  size_t vertex_cnt = 0;
+
+  for (size_t i = 0; i < OCTAGON_DIRECTION_COUNT; i += direction_step) {
+    const Point* const extreme_point = &extreme_points[i];
+
+    if (vertex_cnt > 0 && extreme_point->x == vertices[vertex_cnt - 1].x &&
+        extreme_point->y == vertices[vertex_cnt - 1].y) {
+      continue;
+    }
+
+    vertices[vertex_cnt++] = *extreme_point;
+  }
+
+  while (vertex_cnt > 1 && vertices[vertex_cnt - 1].x == vertices[0].x &&
+         vertices[vertex_cnt - 1].y == vertices[0].y) {
+    vertex_cnt--;
+  }
+
+  return vertex_cnt;
+}
+
+/**
+ * @brief Removes the points that are strictly inside the polygon formed by the extreme points, using the Akl-Toussaint
+ * heuristic.
+ * @details This locates the points with the lowest and highest x-coordinates and y-coordinates. With eight directions,
+ * this also locates the points with the lowest and highest sums and differences of their coordinates. Those extreme
+ * points form a convex polygon inside the convex hull, so every point strictly inside it can't be part of the convex
+ * hull and is removed. The remaining points are moved to the front of the array, keeping their order. This takes a
+ * single pass to locate the extreme points and another to remove the interior points.
+ * @param[in,out] points The points to cull. This will be mutated to start with the remaining points.
+ * @param point_cnt The number of points to cull.
+ * @param direction_cnt The number of directions to locate extreme points in, either `QUADRILATERAL_DIRECTION_COUNT`
+ * or `OCTAGON_DIRECTION_COUNT`.
+ * @return The number of remaining points at the front of the array.
+ */
+size_t cull_interior_points(Point* const points, const size_t point_cnt, const size_t direction_cnt) {
+  if (point_cnt < 3) {
+    return point_cnt;
+  }
+
+  // the extremes in counter-clockwise order, starting from the bottom: -y, x - y, +x, x + y, +y, y - x, -x, -(x + y)
+  size_t extreme_idxs[OCTAGON_DIRECTION_COUNT] = {0};
+
+  for (size_t i = 1; i < point_cnt; i++) {
+    const Point* const pt = &points[i];
+
+    if (pt->y < points[extreme_idxs[0]].y) {
+      extreme_idxs[0] = i;
+    }
+
+    if (pt->x - pt->y > points[extreme_idxs[1]].x - points[extreme_idxs[1]].y) {
+      extreme_idxs[1] = i;
+    }
+
+    if (pt->x > points[extreme_idxs[2]].x) {
+      extreme_idxs[2] = i;
+    }
+
+    if (pt->x + pt->y > points[extreme_idxs[3]].x + points[extreme_idxs[3]].y) {
+      extreme_idxs[3] = i;
+    }
+
+    if (pt->y > points[extreme_idxs[4]].y) {
+      extreme_idxs[4] = i;
+    }
+
+    if (pt->y - pt->x > points[extreme_idxs[5]].y - points[extreme_idxs[5]].x) {
+      extreme_idxs[5] = i;
+    }
+
+    if (pt->x < points[extreme_idxs[6]].x) {
+      extreme_idxs[6] = i;
+    }
+
+    if (pt->x + pt->y < points[extreme_idxs[7]].x + points[extreme_idxs[7]].y) {
+      extreme_idxs[7] = i;
+    }
+  }
+
+  // the extreme points are copied, since compacting the array will overwrite them
+  Point extreme_points[OCTAGON_DIRECTION_COUNT];
+
+  for (size_t i = 0; i < OCTAGON_DIRECTION_COUNT; i++) {
+    extreme_points[i] = points[extreme_idxs[i]];
+  }
+
+  Point vertices[OCTAGON_DIRECTION_COUNT];
+  const size_t vertex_cnt = create_extreme_polygon(extreme_points, direction_cnt, vertices);
+
+  if (vertex_cnt < 3) {
+    return point_cnt;
+  }
+
+  size_t remaining_point_cnt = 0;
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    if (!is_strictly_inside(&points[i], vertices, vertex_cnt)) {
+      points[remaining_point_cnt++] = points[i];
+    }
+  }
+
+  return remaining_point_cnt;
+}
+
+/**
+ * @brief Removes the points that are strictly inside the polygon formed by the extreme points from a structure of
+ * arrays, using the Akl-Toussaint heuristic.
+ * @details This culls exactly the same points as `cull_interior_points`, but the extreme points and the interior points
+ * are located with the vectorized kernels, which hand the nearly collinear points to `orientation`. The interior points
+ * are checked in fixed-size blocks, so this never allocates. The remaining points are moved to the front of the arrays,
+ * keeping their order.
+ * @param[in,out] points The points to cull. This will be mutated to start with the remaining points, and its count will
+ * be updated.
+ * @param direction_cnt The number of directions to locate extreme points in, either `QUADRILATERAL_DIRECTION_COUNT` or
+ * `OCTAGON_DIRECTION_COUNT`.
+ * @return The number of remaining points at the front of the arrays.
+ */
+size_t cull_interior_points_soa(PointSoA* const points, const size_t direction_cnt) {
+  const size_t point_cnt = points->count;
+
+  if (point_cnt < 3) {
+    return point_cnt;
+  }
+
+  size_t extreme_idxs[EXTREME_DIRECTION_COUNT];
+
+  find_extreme_points(points, extreme_idxs);
+
+  Point extreme_points[OCTAGON_DIRECTION_COUNT];
+
+  for (size_t i = 0; i < OCTAGON_DIRECTION_COUNT; i++) {
+    extreme_points[i].x = points->x[extreme_idxs[i]];
+    extreme_points[i].y = points->y[extreme_idxs[i]];
+  }
+
+  Point vertices[OCTAGON_DIRECTION_COUNT];
+  const size_t vertex_cnt = create_extreme_polygon(extreme_points, direction_cnt, vertices);
+
+  if (vertex_cnt < 3) {
+    return point_cnt;
+  }
+
+  unsigned char is_inside[CULLING_BLOCK_SIZE];
+  size_t remaining_point_cnt = 0;
+
+  for (size_t block_start_idx = 0; block_start_idx < point_cnt; block_start_idx += CULLING_BLOCK_SIZE) {
+    const size_t block_point_cnt =
+        point_cnt - block_start_idx < CULLING_BLOCK_SIZE ? point_cnt - block_start_idx : CULLING_BLOCK_SIZE;
+
+    // the block is checked before it is compacted, and compacting only writes at or before the block
+    const PointSoA block = {&points->x[block_start_idx], &points->y[block_start_idx], block_point_cnt, block_point_cnt};
+
+    find_strictly_inside(&block, vertices, vertex_cnt, is_inside);
+
+    for (size_t i = 0; i < block_point_cnt; i++) {
+      if (!is_inside[i]) {
+        points->x[remaining_point_cnt] = block.x[i];
+        points->y[remaining_point_cnt] = block.y[i];
+        remaining_point_cnt++;
+      }
+    }
+  }
+
+  points->count = remaining_point_cnt;
+
+  return remaining_point_cnt;
+}
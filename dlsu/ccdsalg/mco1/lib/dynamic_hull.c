@@ -0,0 +1,682 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/dynamic_hull.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/** @brief The index that refers to no node. */
+#define NO_NODE SIZE_MAX
+
+/** @brief The number of nodes a dynamic convex hull can contain after its first allocation. */
+#define MIN_DYNAMIC_HULL_CAPACITY 16
+
+/** @brief The index of the lower chain's bridges. */
+#define LOWER_CHAIN 0
+
+/** @brief The index of the upper chain's bridges. */
+#define UPPER_CHAIN 1
+
+/** @brief The numerator of the largest fraction of a node's leaves that one of its subtrees can have. */
+#define BALANCE_NUMERATOR 3
+
+/** @brief The denominator of the largest fraction of a node's leaves that one of its subtrees can have. */
+#define BALANCE_DENOMINATOR 4
+
+/** @brief The direction of a point outside of each chain relative to a line along it, from left to right. */
+static const int OUTSIDE_DIRECTIONS[DYNAMIC_HULL_CHAIN_COUNT] = {-1, 1};
+
+/** @brief The state of a walk along a chain of a dynamic convex hull. */
+typedef struct ChainWalk {
+  /** @brief The array to copy the walked points to. */
+  Point* points;
+  /** @brief The number of points walked so far, excluding the skipped endpoints. */
+  size_t point_count;
+  /** @brief The first point of the chain, or `NULL` if it isn't skipped. */
+  const Point* skipped_first_point;
+  /** @brief The last point of the chain, or `NULL` if it isn't skipped. */
+  const Point* skipped_last_point;
+} ChainWalk;
+
+/**
+ * @brief Checks if a point comes before another point when ordered by their x-coordinates, and y-coordinates if
+ * multiple.
+ * @param[in] a The point to check.
+ * @param[in] b The point to check against.
+ * @return Whether point `a` comes before point `b`.
+ */
+static bool is_before(const Point* const a, const Point* const b) {
+  return a->x < b->x || (a->x == b->x && a->y < b->y);
+}
+
+/**
+ * @brief Checks if two points have the same coordinates.
+ * @param[in] a The point to check.
+ * @param[in] b The point to check against.
+ * @return Whether both points have the same coordinates.
+ */
+static bool is_same_point(const Point* const a, const Point* const b) { return a->x == b->x && a->y == b->y; }
+
+/**
+ * @brief Checks if a node is a leaf.
+ * @param[in] node The node to check.
+ * @return Whether the node has no children.
+ */
+static bool is_leaf(const DynamicHullNode* const node) { return node->left == NO_NODE; }
+
+/**
+ * @brief Allocates a node, reusing a freed node if there is one.
+ * @details The leaves' array is grown along with the nodes, so it can always contain every leaf.
+ * @param[in,out] hull The dynamic convex hull to allocate from.
+ * @return The index of the node, or `NO_NODE` if the nodes couldn't be grown.
+ */
+static size_t allocate_node(DynamicHull* const hull) {
+  const size_t node_idx = hull->free_node;
+
+  if (node_idx != NO_NODE) {
+    hull->free_node = hull->nodes[node_idx].right;
+
+    return node_idx;
+  }
+
+  if (hull->used_count == hull->capacity) {
+    if (hull->capacity > SIZE_MAX / 2 / sizeof(DynamicHullNode)) {
+      return NO_NODE;
+    }
+
+    const size_t new_capacity = hull->capacity < MIN_DYNAMIC_HULL_CAPACITY ? MIN_DYNAMIC_HULL_CAPACITY
+                                                                           : hull->capacity * 2;
+    DynamicHullNode* const new_nodes = realloc(hull->nodes, new_capacity * sizeof(DynamicHullNode));
+
+    if (!new_nodes) {
+      return NO_NODE;
+    }
+
+    hull->nodes = new_nodes;
+
+    size_t* const new_leaves = realloc(hull->leaves, new_capacity * sizeof(size_t));
+
+    if (!new_leaves) {
+      return NO_NODE;
+    }
+
+    hull->leaves = new_leaves;
+    hull->capacity = new_capacity;
+  }
+
+  return hull->used_count++;
+}
+
+/**
+ * @brief Frees a node to be reused.
+ * @param[in,out] hull The dynamic convex hull of the node.
+ * @param node_idx The index of the node to free.
+ */
+static void free_node(DynamicHull* const hull, const size_t node_idx) {
+  hull->nodes[node_idx].right = hull->free_node;
+  hull->free_node = node_idx;
+}
+
+/**
+ * @brief Initializes a leaf.
+ * @param[out] leaf The leaf to initialize.
+ * @param[in] point The point of the leaf.
+ * @param parent_idx The index of the leaf's parent, or `NO_NODE` if it is the root.
+ */
+static void create_leaf(DynamicHullNode* const leaf, const Point* const point, const size_t parent_idx) {
+  leaf->point = *point;
+
+  for (size_t i = 0; i < DYNAMIC_HULL_CHAIN_COUNT; i++) {
+    leaf->bridges[i][0] = *point;
+    leaf->bridges[i][1] = *point;
+    leaf->chain_counts[i] = 1;
+  }
+
+  leaf->left = NO_NODE;
+  leaf->right = NO_NODE;
+  leaf->parent = parent_idx;
+  leaf->leaf_count = 1;
+  leaf->multiplicity = 1;
+}
+
+/**
+ * @brief Replaces a child of a node, or the root if it has no parent.
+ * @param[in,out] hull The dynamic convex hull of the node.
+ * @param parent_idx The index of the node, or `NO_NODE` to replace the root.
+ * @param child_idx The index of the child to replace.
+ * @param new_child_idx The index of the child to replace it with.
+ */
+static void replace_child(DynamicHull* const hull, const size_t parent_idx, const size_t child_idx,
+                          const size_t new_child_idx) {
+  if (parent_idx == NO_NODE) {
+    hull->root = new_child_idx;
+  } else if (hull->nodes[parent_idx].left == child_idx) {
+    hull->nodes[parent_idx].left = new_child_idx;
+  } else {
+    hull->nodes[parent_idx].right = new_child_idx;
+  }
+}
+
+/**
+ * @brief Locates the leaf a point belongs to.
+ * @param[in] hull The dynamic convex hull to search. This must not be empty.
+ * @param[in] point The point to search for.
+ * @return The index of the leaf with the point, or of its neighbor if the point isn't in the tree.
+ */
+static size_t find_leaf(const DynamicHull* const hull, const Point* const point) {
+  size_t node_idx = hull->root;
+
+  while (!is_leaf(&hull->nodes[node_idx])) {
+    const DynamicHullNode* const node = &hull->nodes[node_idx];
+
+    node_idx = is_before(&node->point, point) ? node->right : node->left;
+  }
+
+  return node_idx;
+}
+
+/**
+ * @brief Locates the bridge between the chains of a node's subtrees.
+ * @details This is the Overmars-van Leeuwen search. Both subtrees are descended at once, comparing the bridges of the
+ * current nodes, which are edges of their chains. If a point of the right edge is outside of the left edge's line, the
+ * bridge can't be after the left edge, and likewise for the right edge. Otherwise, the bridge is after the left edge or
+ * before the right edge, depending on which side of the split between the subtrees the edges' lines intersect, which
+ * `compare_intersection` decides exactly. Ties are broken towards the outer points, so collinear points never become
+ * part of the chains. The number of points of the node's chain is counted along the way.
+ * @param[in,out] hull The dynamic convex hull of the node.
+ * @param node_idx The index of the node to update the bridge of.
+ * @param chain The index of the chain, either `LOWER_CHAIN` or `UPPER_CHAIN`.
+ */
+static void update_bridge(DynamicHull* const hull, const size_t node_idx, const int chain) {
+  DynamicHullNode* const nodes = hull->nodes;
+  const int outside_direction = OUTSIDE_DIRECTIONS[chain];
+  const Point* const split_point = &nodes[node_idx].point;
+  size_t left_idx = nodes[node_idx].left;
+  size_t right_idx = nodes[node_idx].right;
+  // descending into a right subtree skips the points of its chain before its bridge point
+  size_t left_point_cnt = 1;
+  size_t left_skipped_point_cnt = 0;
+  size_t right_point_cnt = 1;
+  size_t right_skipped_point_cnt = 0;
+
+  while (!is_leaf(&nodes[left_idx]) || !is_leaf(&nodes[right_idx])) {
+    const DynamicHullNode* const left = &nodes[left_idx];
+    const DynamicHullNode* const right = &nodes[right_idx];
+    const Point* const a = &left->bridges[chain][0];
+    const Point* const b = &left->bridges[chain][1];
+    const Point* const c = &right->bridges[chain][0];
+    const Point* const d = &right->bridges[chain][1];
+
+    if (!is_leaf(left) && outside_direction * orientation(a, b, c) >= 0) {
+      left_idx = left->left;
+    } else if (!is_leaf(right) && outside_direction * orientation(b, c, d) >= 0) {
+      right_point_cnt += right->chain_counts[chain];
+      right_skipped_point_cnt += nodes[right->right].chain_counts[chain];
+      right_idx = right->right;
+    } else if (is_leaf(left)) {
+      right_idx = right->left;
+    } else if (is_leaf(right) || compare_intersection(a, b, c, d, split_point) <= 0) {
+      left_point_cnt += left->chain_counts[chain];
+      left_skipped_point_cnt += nodes[left->right].chain_counts[chain];
+      left_idx = left->right;
+    } else {
+      right_idx = right->left;
+    }
+  }
+
+  nodes[node_idx].bridges[chain][0] = nodes[left_idx].point;
+  nodes[node_idx].bridges[chain][1] = nodes[right_idx].point;
+
+  // the node's chain is the left subtree's chain up to the bridge, followed by the right subtree's chain from it
+  const size_t right_chain_point_cnt = nodes[nodes[node_idx].right].chain_counts[chain];
+
+  nodes[node_idx].chain_counts[chain] = (left_point_cnt - left_skipped_point_cnt) + right_chain_point_cnt -
+                                        (right_point_cnt - right_skipped_point_cnt) + 1;
+}
+
+/**
+ * @brief Recalculates the number of leaves and the bridges of an internal node from its children.
+ * @param[in,out] hull The dynamic convex hull of the node.
+ * @param node_idx The index of the node to update.
+ */
+static void update_node(DynamicHull* const hull, const size_t node_idx) {
+  DynamicHullNode* const node = &hull->nodes[node_idx];
+
+  node->leaf_count = hull->nodes[node->left].leaf_count + hull->nodes[node->right].leaf_count;
+
+  update_bridge(hull, node_idx, LOWER_CHAIN);
+  update_bridge(hull, node_idx, UPPER_CHAIN);
+}
+
+/**
+ * @brief Checks if one of an internal node's subtrees has too many of its leaves.
+ * @param[in] hull The dynamic convex hull of the node.
+ * @param node_idx The index of the node to check.
+ * @return Whether a subtree has more than `BALANCE_NUMERATOR / BALANCE_DENOMINATOR` of the node's leaves.
+ */
+static bool is_unbalanced(const DynamicHull* const hull, const size_t node_idx) {
+  const DynamicHullNode* const node = &hull->nodes[node_idx];
+  const size_t left_leaf_cnt = hull->nodes[node->left].leaf_count;
+  const size_t right_leaf_cnt = hull->nodes[node->right].leaf_count;
+  const size_t max_leaf_cnt = left_leaf_cnt > right_leaf_cnt ? left_leaf_cnt : right_leaf_cnt;
+
+  return max_leaf_cnt * BALANCE_DENOMINATOR > node->leaf_count * BALANCE_NUMERATOR;
+}
+
+/**
+ * @brief Moves the leaves of a subtree into the leaves' array in order, and frees its internal nodes.
+ * @param[in,out] hull The dynamic convex hull of the subtree.
+ * @param node_idx The index of the subtree's root node.
+ * @param[in,out] leaf_cnt The number of leaves moved so far.
+ */
+static void collect_leaves(DynamicHull* const hull, const size_t node_idx, size_t* const leaf_cnt) {
+  const DynamicHullNode* const node = &hull->nodes[node_idx];
+
+  if (is_leaf(node)) {
+    hull->leaves[(*leaf_cnt)++] = node_idx;
+
+    return;
+  }
+
+  const size_t right_idx = node->right;
+
+  collect_leaves(hull, node->left, leaf_cnt);
+  collect_leaves(hull, right_idx, leaf_cnt);
+  free_node(hull, node_idx);
+}
+
+/**
+ * @brief Builds a perfectly balanced subtree over a range of the leaves' array.
+ * @details The internal nodes are taken from the nodes freed by `collect_leaves`, so this never allocates.
+ * @param[in,out] hull The dynamic convex hull of the subtree.
+ * @param first_leaf_idx The index of the range's first leaf within the leaves' array.
+ * @param leaf_cnt The number of leaves of the range.
+ * @return The index of the subtree's root node.
+ */
+static size_t build_subtree(DynamicHull* const hull, const size_t first_leaf_idx, const size_t leaf_cnt) {
+  if (leaf_cnt == 1) {
+    return hull->leaves[first_leaf_idx];
+  }
+
+  const size_t left_leaf_cnt = leaf_cnt / 2;
+  const size_t left_idx = build_subtree(hull, first_leaf_idx, left_leaf_cnt);
+  const size_t right_idx = build_subtree(hull, first_leaf_idx + left_leaf_cnt, leaf_cnt - left_leaf_cnt);
+  const size_t node_idx = allocate_node(hull);
+  DynamicHullNode* const node = &hull->nodes[node_idx];
+
+  node->point = hull->nodes[hull->leaves[first_leaf_idx + left_leaf_cnt - 1]].point;
+  node->left = left_idx;
+  node->right = right_idx;
+  node->multiplicity = 0;
+  hull->nodes[left_idx].parent = node_idx;
+  hull->nodes[right_idx].parent = node_idx;
+
+  update_node(hull, node_idx);
+
+  return node_idx;
+}
+
+/**
+ * @brief Recalculates the ancestors of a changed subtree, then rebuilds the highest unbalanced one.
+ * @details Rebuilding a subtree keeps its points, so the bridges above it stay valid.
+ * @param[in,out] hull The dynamic convex hull to update.
+ * @param node_idx The index of the lowest internal node to recalculate.
+ */
+static void update_ancestors(DynamicHull* const hull, size_t node_idx) {
+  size_t unbalanced_node_idx = NO_NODE;
+
+  while (node_idx != NO_NODE) {
+    update_node(hull, node_idx);
+
+    if (is_unbalanced(hull, node_idx)) {
+      unbalanced_node_idx = node_idx;
+    }
+
+    node_idx = hull->nodes[node_idx].parent;
+  }
+
+  if (unbalanced_node_idx == NO_NODE) {
+    return;
+  }
+
+  const size_t parent_idx = hull->nodes[unbalanced_node_idx].parent;
+  size_t leaf_cnt = 0;
+
+  collect_leaves(hull, unbalanced_node_idx, &leaf_cnt);
+
+  const size_t subtree_idx = build_subtree(hull, 0, leaf_cnt);
+
+  hull->nodes[subtree_idx].parent = parent_idx;
+
+  replace_child(hull, parent_idx, unbalanced_node_idx, subtree_idx);
+}
+
+/**
+ * @brief Walks the part of a subtree's chain between two points.
+ * @details A node's chain is its left subtree's chain up to the bridge, followed by its right subtree's chain from the
+ * bridge, so only the subtrees that overlap the range are walked.
+ * @param[in] hull The dynamic convex hull of the subtree.
+ * @param node_idx The index of the subtree's root node.
+ * @param chain The index of the chain, either `LOWER_CHAIN` or `UPPER_CHAIN`.
+ * @param[in] first_point The first point of the range, or `NULL` if it is unbounded.
+ * @param[in] last_point The last point of the range, or `NULL` if it is unbounded.
+ * @param[in,out] walk The state of the walk.
+ */
+static void walk_chain(const DynamicHull* const hull, const size_t node_idx, const int chain,
+                       const Point* const first_point, const Point* const last_point, ChainWalk* const walk) {
+  const DynamicHullNode* const node = &hull->nodes[node_idx];
+
+  if (is_leaf(node)) {
+    const Point* const point = &node->point;
+    const bool is_in_range = (!first_point || !is_before(point, first_point)) &&
+                             (!last_point || !is_before(last_point, point));
+    const bool is_skipped = (walk->skipped_first_point && is_same_point(point, walk->skipped_first_point)) ||
+                            (walk->skipped_last_point && is_same_point(point, walk->skipped_last_point));
+
+    if (is_in_range && !is_skipped) {
+      walk->points[walk->point_count++] = *point;
+    }
+
+    return;
+  }
+
+  const Point* const left_bridge_point = &node->bridges[chain][0];
+  const Point* const right_bridge_point = &node->bridges[chain][1];
+
+  if (!first_point || !is_before(left_bridge_point, first_point)) {
+    const bool is_last_point_kept = last_point && is_before(last_point, left_bridge_point);
+
+    walk_chain(hull, node->left, chain, first_point, is_last_point_kept ? last_point : left_bridge_point, walk);
+  }
+
+  if (!last_point || !is_before(last_point, right_bridge_point)) {
+    const bool is_first_point_kept = first_point && is_before(right_bridge_point, first_point);
+
+    walk_chain(hull, node->right, chain, is_first_point_kept ? first_point : right_bridge_point, last_point, walk);
+  }
+}
+
+/**
+ * @brief Reverses the order of a range of points.
+ * @param[in,out] points The points to reverse.
+ * @param point_cnt The number of points to reverse.
+ */
+static void reverse(Point* const points, const size_t point_cnt) {
+  for (size_t i = 0; i < point_cnt / 2; i++) {
+    const Point temp = points[i];
+
+    points[i] = points[point_cnt - 1 - i];
+    points[point_cnt - 1 - i] = temp;
+  }
+}
+
+/**
+ * @brief Walks both chains of a dynamic convex hull, copying their points.
+ * @details The lower chain is walked from left to right, followed by the upper chain without its endpoints, which are
+ * shared with the lower chain. The upper chain's points are reversed, so the points are counter-clockwise.
+ * @param[in] hull The dynamic convex hull to walk. This must have at least two distinct points.
+ * @param[out] points The array to copy the points to.
+ * @param[out] lower_point_cnt The number of points of the lower chain.
+ * @return The number of points from the convex set.
+ */
+static size_t walk_chains(const DynamicHull* const hull, Point* const points, size_t* const lower_point_cnt) {
+  size_t first_leaf_idx = hull->root;
+  size_t last_leaf_idx = hull->root;
+
+  while (!is_leaf(&hull->nodes[first_leaf_idx])) {
+    first_leaf_idx = hull->nodes[first_leaf_idx].left;
+  }
+
+  while (!is_leaf(&hull->nodes[last_leaf_idx])) {
+    last_leaf_idx = hull->nodes[last_leaf_idx].right;
+  }
+
+  ChainWalk lower_walk = {points, 0, NULL, NULL};
+
+  walk_chain(hull, hull->root, LOWER_CHAIN, NULL, NULL, &lower_walk);
+
+  ChainWalk upper_walk = {&points[lower_walk.point_count], 0, &hull->nodes[first_leaf_idx].point,
+                          &hull->nodes[last_leaf_idx].point};
+
+  walk_chain(hull, hull->root, UPPER_CHAIN, NULL, NULL, &upper_walk);
+
+  reverse(upper_walk.points, upper_walk.point_count);
+
+  *lower_point_cnt = lower_walk.point_count;
+
+  return lower_walk.point_count + upper_walk.point_count;
+}
+
+/**
+ * @brief Initializes a dynamic convex hull to be empty.
+ * @details This doesn't allocate.
+ * @relates DynamicHull
+ * @param[in,out] hull The dynamic convex hull to initialize.
+ */
+void create_dynamic_hull(DynamicHull* const hull) {
+  hull->nodes = NULL;
+  hull->leaves = NULL;
+  hull->root = NO_NODE;
+  hull->point_count = 0;
+  hull->capacity = 0;
+  hull->used_count = 0;
+  hull->free_node = NO_NODE;
+}
+
+/**
+ * @brief Inserts a point into a dynamic convex hull.
+ * @details A point equal to one already inserted is counted, so it stays until it is removed as many times as it was
+ * inserted. This takes `O(log^2 n)` amortized time.
+ * @relates DynamicHull
+ * @param[in,out] hull The dynamic convex hull to insert into.
+ * @param point The point to insert.
+ * @return Whether the tree could be grown to contain the point.
+ */
+bool insert_dynamic_hull_point(DynamicHull* const hull, const Point point) {
+  if (hull->root == NO_NODE) {
+    const size_t leaf_idx = allocate_node(hull);
+
+    if (leaf_idx == NO_NODE) {
+      return false;
+    }
+
+    create_leaf(&hull->nodes[leaf_idx], &point, NO_NODE);
+
+    hull->root = leaf_idx;
+    hull->point_count++;
+
+    return true;
+  }
+
+  const size_t leaf_idx = find_leaf(hull, &point);
+
+  if (is_same_point(&hull->nodes[leaf_idx].point, &point)) {
+    hull->nodes[leaf_idx].multiplicity++;
+    hull->point_count++;
+
+    return true;
+  }
+
+  const size_t new_leaf_idx = allocate_node(hull);
+
+  if (new_leaf_idx == NO_NODE) {
+    return false;
+  }
+
+  const size_t node_idx = allocate_node(hull);
+
+  if (node_idx == NO_NODE) {
+    free_node(hull, new_leaf_idx);
+
+    return false;
+  }
+
+  // the leaf is replaced by a node with the leaf and the new leaf as its children, in order
+  DynamicHullNode* const nodes = hull->nodes;
+  DynamicHullNode* const node = &nodes[node_idx];
+  const size_t parent_idx = nodes[leaf_idx].parent;
+  const bool is_new_leaf_left = is_before(&point, &nodes[leaf_idx].point);
+
+  create_leaf(&nodes[new_leaf_idx], &point, node_idx);
+
+  node->left = is_new_leaf_left ? new_leaf_idx : leaf_idx;
+  node->right = is_new_leaf_left ? leaf_idx : new_leaf_idx;
+  node->point = nodes[node->left].point;
+  node->parent = parent_idx;
+  node->multiplicity = 0;
+  nodes[leaf_idx].parent = node_idx;
+
+  replace_child(hull, parent_idx, leaf_idx, node_idx);
+
+  hull->point_count++;
+
+  update_ancestors(hull, node_idx);
+
+  return true;
+}
+
+/**
+ * @brief Removes a point from a dynamic convex hull.
+ * @details This never allocates, and takes `O(log^2 n)` amortized time.
+ * @relates DynamicHull
+ * @param[in,out] hull The dynamic convex hull to remove from.
+ * @param point The point to remove.
+ * @return Whether the point was inserted and not removed yet.
+ */
+bool remove_dynamic_hull_point(DynamicHull* const hull, const Point point) {
+  if (hull->root == NO_NODE) {
+    return false;
+  }
+
+  const size_t leaf_idx = find_leaf(hull, &point);
+  DynamicHullNode* const nodes = hull->nodes;
+
+  if (!is_same_point(&nodes[leaf_idx].point, &point)) {
+    return false;
+  }
+
+  hull->point_count--;
+
+  if (--nodes[leaf_idx].multiplicity > 0) {
+    return true;
+  }
+
+  // the leaf's parent is replaced by the leaf's sibling
+  const size_t parent_idx = nodes[leaf_idx].parent;
+
+  free_node(hull, leaf_idx);
+
+  if (parent_idx == NO_NODE) {
+    hull->root = NO_NODE;
+
+    return true;
+  }
+
+  const size_t sibling_idx = nodes[parent_idx].left == leaf_idx ? nodes[parent_idx].right : nodes[parent_idx].left;
+  const size_t grandparent_idx = nodes[parent_idx].parent;
+
+  nodes[sibling_idx].parent = grandparent_idx;
+
+  replace_child(hull, grandparent_idx, parent_idx, sibling_idx);
+  free_node(hull, parent_idx);
+
+  if (grandparent_idx != NO_NODE) {
+    update_ancestors(hull, grandparent_idx);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Gets the number of points that make up a dynamic convex hull.
+ * @details Every node keeps the number of points of its chains up to date, so this takes `O(1)` time.
+ * @relates DynamicHull
+ * @param[in] hull The dynamic convex hull to use.
+ * @return The number of points from the convex set.
+ */
+size_t get_dynamic_hull_point_count(const DynamicHull* const hull) {
+  if (hull->root == NO_NODE) {
+    return 0;
+  }
+
+  if (is_leaf(&hull->nodes[hull->root])) {
+    return 1;
+  }
+
+  // both chains start and end at the leftmost and the rightmost points
+  const DynamicHullNode* const root = &hull->nodes[hull->root];
+
+  return root->chain_counts[LOWER_CHAIN] + root->chain_counts[UPPER_CHAIN] - 2;
+}
+
+/**
+ * @brief Copies the points that make up a dynamic convex hull into a caller-owned array.
+ * @details The points are in the same order as the Graham scans: counter-clockwise, starting from the point with the
+ * lowest y-coordinate, and lowest x-coordinate if multiple. This takes `O(h log n)` time.
+ * @relates DynamicHull
+ * @param[in] hull The dynamic convex hull to use.
+ * @param[out] convex_points The array to copy the points from the convex set to. This must be able to contain
+ * `get_dynamic_hull_point_count` points.
+ * @return The number of points from the convex set.
+ */
+size_t copy_dynamic_hull_points(const DynamicHull* const hull, Point* const convex_points) {
+  if (hull->root == NO_NODE) {
+    return 0;
+  }
+
+  if (is_leaf(&hull->nodes[hull->root])) {
+    convex_points[0] = hull->nodes[hull->root].point;
+
+    return 1;
+  }
+
+  size_t lower_point_cnt;
+  const size_t convex_point_cnt = walk_chains(hull, convex_points, &lower_point_cnt);
+
+  // the anchor point is always on the lower chain, and rotating the points makes it the first
+  size_t anchor_point_idx = 0;
+
+  for (size_t i = 1; i < lower_point_cnt; i++) {
+    const Point* const anchor_point = &convex_points[anchor_point_idx];
+    const Point* const pt = &convex_points[i];
+
+    if (pt->y < anchor_point->y || (pt->y == anchor_point->y && pt->x < anchor_point->x)) {
+      anchor_point_idx = i;
+    }
+  }
+
+  reverse(convex_points, anchor_point_idx);
+  reverse(&convex_points[anchor_point_idx], convex_point_cnt - anchor_point_idx);
+  reverse(convex_points, convex_point_cnt);
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Frees the tree of a dynamic convex hull.
+ * @details This resets the convex hull to be empty, so it can be reused.
+ * @relates DynamicHull
+ * @param[in,out] hull The dynamic convex hull to free.
+ */
+void destroy_dynamic_hull(DynamicHull* const hull) {
+  free(hull->nodes);
+  free(hull->leaves);
+
+  create_dynamic_hull(hull);
+}
@@ -19,6 +19,7 @@
 #include "convex_hull/geometry.h"
 
 #include <math.h>
+#include <stdbool.h>
 #include <stdlib.h>
 
 /**
@@ -33,18 +34,502 @@ double distance(const Point* const a, const Point* const b) {
   return sqrt(pow(fabs(a->x - b->x), 2) + pow(fabs(a->y - b->y), 2));
 }
 
+/** @brief The constant that splits a double into two halves of 26 bits each, `2^27 + 1`. */
+#define SPLITTER 134217729.0
+
+/** @brief The relative error bound of the orientation from the exact products of the rounded differences. */
+#define ORIENTATION_BOUND_B ((2.0 + 12.0 * ROUNDING_EPSILON) * ROUNDING_EPSILON)
+
+/** @brief The relative error bound of the orientation corrected by the differences' first-order tails. */
+#define ORIENTATION_BOUND_C ((9.0 + 64.0 * ROUNDING_EPSILON) * ROUNDING_EPSILON * ROUNDING_EPSILON)
+
+/** @brief The relative error bound of rounding an approximate orientation. */
+#define RESULT_BOUND ((3.0 + 8.0 * ROUNDING_EPSILON) * ROUNDING_EPSILON)
+
+/**
+ * @brief The relative error bound of the differences and the numerator of a line intersection calculated with doubles.
+ * @details Both are within about six roundings of their exact values, relative to the magnitudes of their products.
+ */
+#define INTERSECTION_ERROR_BOUND (8.0 * ROUNDING_EPSILON)
+
+/**
+ * @brief Adds two doubles exactly, where the first's magnitude is at least the second's.
+ * @param a The larger addend.
+ * @param b The smaller addend.
+ * @param[out] error The rounding error of the sum, so the exact sum is the returned sum plus the error.
+ * @return The rounded sum.
+ */
+static double fast_two_sum(const double a, const double b, double* const error) {
+  const double sum = a + b;
+
+  *error = b - (sum - a);
+
+  return sum;
+}
+
+/**
+ * @brief Adds two doubles exactly.
+ * @param a The first addend.
+ * @param b The second addend.
+ * @param[out] error The rounding error of the sum, so the exact sum is the returned sum plus the error.
+ * @return The rounded sum.
+ */
+static double two_sum(const double a, const double b, double* const error) {
+  const double sum = a + b;
+  const double b_virtual = sum - a;
+  const double a_virtual = sum - b_virtual;
+
+  *error = (a - a_virtual) + (b - b_virtual);
+
+  return sum;
+}
+
+/**
+ * @brief Calculates the rounding error of a difference of two doubles.
+ * @param a The minuend.
+ * @param b The subtrahend.
+ * @param difference The rounded difference of the doubles.
+ * @return The rounding error, so the exact difference is the rounded difference plus the error.
+ */
+static double two_diff_tail(const double a, const double b, const double difference) {
+  const double b_virtual = a - difference;
+  const double a_virtual = difference + b_virtual;
+
+  return (a - a_virtual) + (b_virtual - b);
+}
+
+/**
+ * @brief Splits a double into a high and a low half, each with at most 26 significant bits.
+ * @param value The double to split.
+ * @param[out] high The high half, so the double is the high half plus the low half.
+ * @param[out] low The low half.
+ */
+static void split(const double value, double* const high, double* const low) {
+  const double scaled_value = SPLITTER * value;
+
+  *high = scaled_value - (scaled_value - value);
+  *low = value - *high;
+}
+
+/**
+ * @brief Multiplies two doubles exactly.
+ * @details This is Dekker's product. The halves of the factors multiply without rounding, so the rounding error of the
+ * product is recovered from them.
+ * @param a The first factor.
+ * @param b The second factor.
+ * @param[out] error The rounding error of the product, so the exact product is the returned product plus the error.
+ * @return The rounded product.
+ */
+static double two_product(const double a, const double b, double* const error) {
+  const double product = a * b;
+  double a_high;
+  double a_low;
+  double b_high;
+  double b_low;
+
+  split(a, &a_high, &a_low);
+  split(b, &b_high, &b_low);
+
+  *error = a_low * b_low - (((product - a_high * b_high) - a_low * b_high) - a_high * b_low);
+
+  return product;
+}
+
+/**
+ * @brief Subtracts two exact products, each the sum of two doubles, into an expansion.
+ * @param[in] a The first product's rounded value and error, from the smallest component.
+ * @param[in] b The second product's rounded value and error, from the smallest component.
+ * @param[out] difference The expansion of the exact difference, from the smallest component.
+ */
+static void two_two_diff(const double a[2], const double b[2], double difference[4]) {
+  double high_sum;
+  double low_sum;
+  double low_error;
+
+  low_sum = two_sum(a[0], -b[0], &difference[0]);
+  high_sum = two_sum(a[1], low_sum, &low_error);
+  low_sum = two_sum(low_error, -b[1], &difference[1]);
+  difference[3] = two_sum(high_sum, low_sum, &difference[2]);
+}
+
+/**
+ * @brief Creates the expansion of an exact product difference with the components of two products.
+ * @param a The first factor of the first product.
+ * @param b The second factor of the first product.
+ * @param c The first factor of the second product.
+ * @param d The second factor of the second product.
+ * @param[out] difference The expansion of `a * b - c * d`, from the smallest component.
+ */
+static void product_diff(const double a, const double b, const double c, const double d, double difference[4]) {
+  double first_product[2];
+  double second_product[2];
+
+  first_product[1] = two_product(a, b, &first_product[0]);
+  second_product[1] = two_product(c, d, &second_product[0]);
+
+  two_two_diff(first_product, second_product, difference);
+}
+
+/**
+ * @brief Adds two expansions exactly, removing the zero components.
+ * @details Both expansions must be nonoverlapping and ordered from the smallest component. The components are merged
+ * by their magnitudes and accumulated with exact sums, so the sum is also a nonoverlapping expansion.
+ * @param[in] e The first expansion.
+ * @param e_len The number of components of the first expansion.
+ * @param[in] f The second expansion.
+ * @param f_len The number of components of the second expansion.
+ * @param[out] sum The expansion of the sum. This must be able to contain `e_len + f_len` components.
+ * @return The number of components of the sum.
+ */
+static size_t sum_expansions(const double* const e, const size_t e_len, const double* const f, const size_t f_len,
+                             double* const sum) {
+  size_t e_idx = 0;
+  size_t f_idx = 0;
+  size_t sum_len = 0;
+  double accumulator = 0;
+  double error;
+
+  for (size_t i = 0; i < e_len + f_len; i++) {
+    const bool is_e_next = f_idx == f_len || (e_idx < e_len && (f[f_idx] > e[e_idx]) == (f[f_idx] > -e[e_idx]));
+    const double component = is_e_next ? e[e_idx++] : f[f_idx++];
+
+    if (i == 0) {
+      accumulator = component;
+
+      continue;
+    }
+
+    accumulator = i == 1 ? fast_two_sum(component, accumulator, &error) : two_sum(accumulator, component, &error);
+
+    if (error != 0) {
+      sum[sum_len++] = error;
+    }
+  }
+
+  if (accumulator != 0 || sum_len == 0) {
+    sum[sum_len++] = accumulator;
+  }
+
+  return sum_len;
+}
+
+/**
+ * @brief Multiplies an expansion by a double exactly, removing the zero components.
+ * @param[in] e The expansion to multiply, from the smallest component.
+ * @param e_len The number of components of the expansion.
+ * @param b The double to multiply by.
+ * @param[out] product The expansion of the product. This must be able to contain `2 * e_len` components.
+ * @return The number of components of the product.
+ */
+static size_t scale_expansion(const double* const e, const size_t e_len, const double b, double* const product) {
+  size_t product_len = 0;
+  double error;
+  double accumulator = two_product(e[0], b, &error);
+
+  if (error != 0) {
+    product[product_len++] = error;
+  }
+
+  for (size_t i = 1; i < e_len; i++) {
+    double product_error;
+    const double component_product = two_product(e[i], b, &product_error);
+    const double sum = two_sum(accumulator, product_error, &error);
+
+    if (error != 0) {
+      product[product_len++] = error;
+    }
+
+    accumulator = fast_two_sum(component_product, sum, &error);
+
+    if (error != 0) {
+      product[product_len++] = error;
+    }
+  }
+
+  if (accumulator != 0 || product_len == 0) {
+    product[product_len++] = accumulator;
+  }
+
+  return product_len;
+}
+
+/**
+ * @brief Calculates the cross product of the orientation of three points exactly.
+ * @details The cross product of the rounded differences is calculated exactly, then corrected by the exact products of
+ * the differences' rounding errors.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @param[in] b The third point to use.
+ * @param[out] area The expansion of the cross product, from the smallest component. This must be able to contain
+ * `16` components.
+ * @return The number of components of the cross product.
+ */
+static size_t exact_area(const Point* const a, const Point* const vertex, const Point* const b, double area[16]) {
+  const double a_dx = a->x - b->x;
+  const double vertex_dx = vertex->x - b->x;
+  const double a_dy = a->y - b->y;
+  const double vertex_dy = vertex->y - b->y;
+  const double a_dx_tail = two_diff_tail(a->x, b->x, a_dx);
+  const double vertex_dx_tail = two_diff_tail(vertex->x, b->x, vertex_dx);
+  const double a_dy_tail = two_diff_tail(a->y, b->y, a_dy);
+  const double vertex_dy_tail = two_diff_tail(vertex->y, b->y, vertex_dy);
+  double area_b[4];
+  double tail_area[4];
+  double area_c1[8];
+  double area_c2[12];
+
+  product_diff(a_dx, vertex_dy, a_dy, vertex_dx, area_b);
+  product_diff(a_dx_tail, vertex_dy, a_dy_tail, vertex_dx, tail_area);
+
+  const size_t area_c1_len = sum_expansions(area_b, 4, tail_area, 4, area_c1);
+
+  product_diff(a_dx, vertex_dy_tail, a_dy, vertex_dx_tail, tail_area);
+
+  const size_t area_c2_len = sum_expansions(area_c1, area_c1_len, tail_area, 4, area_c2);
+
+  product_diff(a_dx_tail, vertex_dy_tail, a_dy_tail, vertex_dx_tail, tail_area);
+
+  return sum_expansions(area_c2, area_c2_len, tail_area, 4, area);
+}
+
+/**
+ * @brief Calculates the orientation of three points exactly when the fast orientation is too close to call.
+ * @details This is the adaptive part of Shewchuk's orientation predicate. The cross product of the rounded differences
+ * is calculated exactly, then corrected by the differences' rounding errors, first approximately and finally exactly.
+ * Every stage stops as soon as its error bound proves the sign.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @param[in] b The third point to use.
+ * @param magnitude The sum of the magnitudes of the fast orientation's products.
+ * @return A value with the sign of the exact cross product.
+ */
+static double adaptive_area(const Point* const a, const Point* const vertex, const Point* const b,
+                            const double magnitude) {
+  const double a_dx = a->x - b->x;
+  const double vertex_dx = vertex->x - b->x;
+  const double a_dy = a->y - b->y;
+  const double vertex_dy = vertex->y - b->y;
+  double area_b[4];
+
+  product_diff(a_dx, vertex_dy, a_dy, vertex_dx, area_b);
+
+  double area = area_b[0] + area_b[1] + area_b[2] + area_b[3];
+  double error_bound = ORIENTATION_BOUND_B * magnitude;
+
+  if (area >= error_bound || -area >= error_bound) {
+    return area;
+  }
+
+  const double a_dx_tail = two_diff_tail(a->x, b->x, a_dx);
+  const double vertex_dx_tail = two_diff_tail(vertex->x, b->x, vertex_dx);
+  const double a_dy_tail = two_diff_tail(a->y, b->y, a_dy);
+  const double vertex_dy_tail = two_diff_tail(vertex->y, b->y, vertex_dy);
+
+  if (a_dx_tail == 0 && a_dy_tail == 0 && vertex_dx_tail == 0 && vertex_dy_tail == 0) {
+    return area;
+  }
+
+  error_bound = ORIENTATION_BOUND_C * magnitude + RESULT_BOUND * fabs(area);
+  area += (a_dx * vertex_dy_tail + vertex_dy * a_dx_tail) - (a_dy * vertex_dx_tail + vertex_dx * a_dy_tail);
+
+  if (area >= error_bound || -area >= error_bound) {
+    return area;
+  }
+
+  double area_d[16];
+
+  return area_d[exact_area(a, vertex, b, area_d) - 1];
+}
+
 /**
  * @brief Calculates the orientation of the angle formed by connecting three points.
- * @details This uses the cross product of the two vectors formed by the three points to determine the orientation.
+ * @details This uses the cross product of the two vectors formed by the three points to determine the orientation. The
+ * cross product is first calculated with doubles, which is only trusted if it is farther from zero than its rounding
+ * error can be. Otherwise, the cross product is recalculated adaptively with exact floating-point expansions, like
+ * Shewchuk's robust predicates, so nearly collinear points always get the correct orientation.
  * @param[in] a The first point to use.
  * @param[in] vertex The vertex to use.
  * @param[in] b The third point to use.
  * @return `-1` if the angle is clockwise, `1` if counter-clockwise, or `0` if collinear.
  */
 int orientation(const Point* const a, const Point* const vertex, const Point* const b) {
-  const double area = (vertex->x - a->x) * (b->y - a->y) - (vertex->y - a->y) * (b->x - a->x);
+  const double left_product = (a->x - b->x) * (vertex->y - b->y);
+  const double right_product = (a->y - b->y) * (vertex->x - b->x);
+  const double magnitude = fabs(left_product) + fabs(right_product);
+  double area = left_product - right_product;
+
+  // the rounded cross product only has the wrong sign if the products nearly cancel out
+  if (fabs(area) < ORIENTATION_ERROR_BOUND * magnitude) {
+    area = adaptive_area(a, vertex, b, magnitude);
+  }
+
+  return area > 0 ? 1 : area < 0 ? -1 : 0;
+}
+
+/**
+ * @brief Calculates the sign of a coordinate of a line intersection relative to a point's, exactly.
+ * @details The coordinate of the intersection of the lines `ab` and `cd` minus the point's is `c_area * (d - point) -
+ * d_area * (c - point)` divided by `c_area - d_area`, where the areas are the cross products of `ab` with `c` and `d`.
+ * This calculates the numerator, whose differences are split into their rounded values and their rounding errors.
+ * @param[in] c_area The expansion of the cross product of the first line with `c`.
+ * @param c_area_len The number of components of the cross product with `c`.
+ * @param[in] d_area The expansion of the cross product of the first line with `d`.
+ * @param d_area_len The number of components of the cross product with `d`.
+ * @param c_coordinate The coordinate of `c`.
+ * @param d_coordinate The coordinate of `d`.
+ * @param point_coordinate The coordinate of the point.
+ * @return A value with the sign of the numerator.
+ */
+static double intersection_numerator(const double* const c_area, const size_t c_area_len, const double* const d_area,
+                                     const size_t d_area_len, const double c_coordinate, const double d_coordinate,
+                                     const double point_coordinate) {
+  const double c_delta = c_coordinate - point_coordinate;
+  const double d_delta = d_coordinate - point_coordinate;
+  double products[4][32];
+  double sums[2][64];
+  double numerator[128];
+  const size_t product_lens[4] = {
+      scale_expansion(c_area, c_area_len, d_delta, products[0]),
+      scale_expansion(c_area, c_area_len, two_diff_tail(d_coordinate, point_coordinate, d_delta), products[1]),
+      scale_expansion(d_area, d_area_len, -c_delta, products[2]),
+      scale_expansion(d_area, d_area_len, -two_diff_tail(c_coordinate, point_coordinate, c_delta), products[3]),
+  };
+  const size_t sum_lens[2] = {
+      sum_expansions(products[0], product_lens[0], products[1], product_lens[1], sums[0]),
+      sum_expansions(products[2], product_lens[2], products[3], product_lens[3], sums[1]),
+  };
 
-  return area < 0 ? -1 : area > 0 ? 1 : 0;
+  return numerator[sum_expansions(sums[0], sum_lens[0], sums[1], sum_lens[1], numerator) - 1];
+}
+
+/**
+ * @brief Compares the intersection of two lines with a point exactly when the fast comparison is too close to call.
+ * @param[in] a The start of the first line.
+ * @param[in] b The end of the first line.
+ * @param[in] c The start of the second line.
+ * @param[in] d The end of the second line.
+ * @param[in] point The point to compare against.
+ * @return `-1` if the intersection comes before the point, `1` if after, or `0` if they are the same point.
+ */
+static int exact_compare_intersection(const Point* const a, const Point* const b, const Point* const c,
+                                      const Point* const d, const Point* const point) {
+  double c_area[16];
+  double d_area[16];
+  double negated_d_area[16];
+  double denominator[32];
+  const size_t c_area_len = exact_area(a, b, c, c_area);
+  const size_t d_area_len = exact_area(a, b, d, d_area);
+
+  for (size_t i = 0; i < d_area_len; i++) {
+    negated_d_area[i] = -d_area[i];
+  }
+
+  const size_t denominator_len = sum_expansions(c_area, c_area_len, negated_d_area, d_area_len, denominator);
+  double numerator = intersection_numerator(c_area, c_area_len, d_area, d_area_len, c->x, d->x, point->x);
+
+  if (numerator == 0) {
+    numerator = intersection_numerator(c_area, c_area_len, d_area, d_area_len, c->y, d->y, point->y);
+  }
+
+  if (numerator == 0) {
+    return 0;
+  }
+
+  return (numerator > 0) == (denominator[denominator_len - 1] > 0) ? 1 : -1;
+}
+
+/**
+ * @brief Compares the intersection of two lines with a point by their x-coordinates, and y-coordinates if equal.
+ * @details The intersection is never rounded. Its coordinates relative to the point are fractions of cross products,
+ * whose signs are first calculated with doubles and only trusted if they are farther from zero than their rounding
+ * errors can be. Otherwise, they are recalculated exactly with the same floating-point expansions as `orientation`.
+ * @param[in] a The start of the first line.
+ * @param[in] b The end of the first line.
+ * @param[in] c The start of the second line.
+ * @param[in] d The end of the second line. The lines must not be parallel.
+ * @param[in] point The point to compare against.
+ * @return `-1` if the intersection comes before the point, `1` if after, or `0` if they are the same point.
+ */
+int compare_intersection(const Point* const a, const Point* const b, const Point* const c, const Point* const d,
+                         const Point* const point) {
+  const double line_x = b->x - a->x;
+  const double line_y = b->y - a->y;
+  const double c_left_product = line_x * (c->y - a->y);
+  const double c_right_product = line_y * (c->x - a->x);
+  const double d_left_product = line_x * (d->y - a->y);
+  const double d_right_product = line_y * (d->x - a->x);
+  const double c_magnitude = fabs(c_left_product) + fabs(c_right_product);
+  const double d_magnitude = fabs(d_left_product) + fabs(d_right_product);
+  const double c_area = c_left_product - c_right_product;
+  const double d_area = d_left_product - d_right_product;
+  const double c_delta = c->x - point->x;
+  const double d_delta = d->x - point->x;
+  const double numerator = c_area * d_delta - d_area * c_delta;
+  const double denominator = c_area - d_area;
+
+  // the intersection's x-coordinate only has the wrong side if either cross product nearly cancels out
+  if (fabs(numerator) <= INTERSECTION_ERROR_BOUND * (c_magnitude * fabs(d_delta) + d_magnitude * fabs(c_delta)) ||
+      fabs(denominator) <= INTERSECTION_ERROR_BOUND * (c_magnitude + d_magnitude)) {
+    return exact_compare_intersection(a, b, c, d, point);
+  }
+
+  return (numerator > 0) == (denominator > 0) ? 1 : -1;
+}
+
+/**
+ * @brief Compares the cross products of a line with two points exactly when the fast comparison is too close to call.
+ * @param[in] a The start of the line.
+ * @param[in] b The end of the line.
+ * @param[in] c The first point to compare.
+ * @param[in] d The second point to compare.
+ * @return `-1` if the cross product with `c` is less than with `d`, `1` if greater, or `0` if they are equal.
+ */
+static int exact_compare_areas(const Point* const a, const Point* const b, const Point* const c, const Point* const d) {
+  double c_area[16];
+  double d_area[16];
+  double negated_d_area[16];
+  double difference[32];
+  const size_t c_area_len = exact_area(a, b, c, c_area);
+  const size_t d_area_len = exact_area(a, b, d, d_area);
+
+  for (size_t i = 0; i < d_area_len; i++) {
+    negated_d_area[i] = -d_area[i];
+  }
+
+  const double area_difference = difference[sum_expansions(c_area, c_area_len, negated_d_area, d_area_len,
+                                                           difference) - 1];
+
+  return area_difference > 0 ? 1 : area_difference < 0 ? -1 : 0;
+}
+
+/**
+ * @brief Compares the cross products of a line with two points, which orders the points by their signed distances from
+ * the line.
+ * @details The cross products are never rounded. Their difference is first calculated with doubles, which is only
+ * trusted if it is farther from zero than its rounding error can be. Otherwise, both are recalculated exactly with the
+ * same floating-point expansions as `orientation`.
+ * @param[in] a The start of the line.
+ * @param[in] b The end of the line.
+ * @param[in] c The first point to compare.
+ * @param[in] d The second point to compare.
+ * @return `-1` if the cross product with `c` is less than with `d`, `1` if greater, or `0` if they are equal.
+ */
+int compare_areas(const Point* const a, const Point* const b, const Point* const c, const Point* const d) {
+  const double line_x = b->x - a->x;
+  const double line_y = b->y - a->y;
+  const double c_left_product = line_x * (c->y - a->y);
+  const double c_right_product = line_y * (c->x - a->x);
+  const double d_left_product = line_x * (d->y - a->y);
+  const double d_right_product = line_y * (d->x - a->x);
+  const double difference = (c_left_product - c_right_product) - (d_left_product - d_right_product);
+
+  // the difference is a line intersection's denominator, so it has the same rounding error
+  if (fabs(difference) <= INTERSECTION_ERROR_BOUND * (fabs(c_left_product) + fabs(c_right_product) +
+                                                      fabs(d_left_product) + fabs(d_right_product))) {
+    return exact_compare_areas(a, b, c, d);
+  }
+
+  return difference > 0 ? 1 : -1;
 }
 
 /**
@@ -58,3 +543,39 @@ double polar_angle(const Point* const point, const Point* const anchor_point) {
 
   return isnan(angle) ? 0 : angle;
 }
+
+/**
+ * @brief Calculates the squared distance between two points.
+ * @details This orders points exactly like `distance`, but without the square root.
+ * @param[in] a The first point to use.
+ * @param[in] b The second point to use.
+ * @return The squared distance between point `a` and point `b`.
+ */
+double squared_distance(const Point* const a, const Point* const b) {
+  const double delta_x = a->x - b->x;
+  const double delta_y = a->y - b->y;
+
+  return delta_x * delta_x + delta_y * delta_y;
+}
+
+/**
+ * @brief Calculates the pseudo-angle of a point.
+ * @details This increases with the polar angle, ranging from `-2` to `2` instead of from `-pi` to `pi`, but uses a
+ * single division instead of a trigonometric function.
+ * @param[in] point The point to calculate the pseudo-angle of.
+ * @param[in] anchor_point The anchor or origin point to use.
+ * @return The pseudo-angle of a point.
+ */
+double pseudo_angle(const Point* const point, const Point* const anchor_point) {
+  const double delta_x = point->x - anchor_point->x;
+  const double delta_y = point->y - anchor_point->y;
+  const double manhattan_length = fabs(delta_x) + fabs(delta_y);
+
+  if (manhattan_length == 0) {
+    return 0;
+  }
+
+  const double ratio = delta_x / manhattan_length;
+
+  return delta_y < 0 ? ratio - 1 : 1 - ratio;
+}
@@ -0,0 +1,199 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/graham_scan.h"
+
+#include "convex_hull/sort.h"
+#include "convex_hull/stack.h"
+
+/**
+ * @brief Checks if two points have the same coordinates.
+ * @param[in] a The point to check.
+ * @param[in] b The point to check against.
+ * @return Whether both points have the same coordinates.
+ */
+static bool is_same_point(const Point* const a, const Point* const b) {
+  return a->x == b->x && a->y == b->y;
+}
+
+/**
+ * @brief Locates the point with the lowest y-coordinate, and lowest x-coordinate if multiple.
+ * @details This is the first phase of a Graham scan. The points are then sorted around this anchor point.
+ * @param[in] points The points to search.
+ * @param point_cnt The number of points to search. This must be at least one.
+ * @return The anchor point.
+ */
+Point find_anchor_point(const Point* const points, const size_t point_cnt) {
+  size_t anchor_point_idx = 0;
+
+  for (size_t i = 1; i < point_cnt; i++) {
+    const Point* const anchor_point = &points[anchor_point_idx];
+    const Point* const pt = &points[i];
+
+    if (pt->y < anchor_point->y || (pt->y == anchor_point->y && pt->x < anchor_point->x)) {
+      anchor_point_idx = i;
+    }
+  }
+
+  return points[anchor_point_idx];
+}
+
+/**
+ * @brief Checks points already sorted around the anchor point one-by-one for the direction of the angle they form.
+ * @details This is the last phase of a Graham scan. All points starting from the anchor point that have a
+ * counter-clockwise direction form the convex hull. This never allocates. The array doubles as the scan's stack, so it
+ * must fit every point the scan has yet to reject.
+ * @param[in] points The sorted points to check.
+ * @param point_cnt The number of points to check. This must be at least three.
+ * @param[in] anchor_point The anchor point the points were sorted around.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_cnt The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_cnt` always fits.
+ */
+bool scan_sorted_points_into(const Point* const points, const size_t point_cnt, const Point* const anchor_point,
+                             Point* const convex_points, const size_t convex_point_capacity,
+                             size_t* const convex_point_cnt) {
+  if (convex_point_capacity < 2) {
+    return false;
+  }
+
+  Stack stack;
+
+  create(&stack, convex_points, convex_point_capacity);
+
+  push(&stack, points[0]);
+  push(&stack, points[1]);
+
+  for (size_t i = 2; i < point_cnt; i++) {
+    Point curr_point = pop(&stack);
+    const Point* const next_point = &points[i];
+
+    while (!is_empty(&stack) && orientation(top(&stack), &curr_point, next_point) <= 0) {
+      curr_point = pop(&stack);
+    }
+
+    push(&stack, curr_point);
+
+    if (is_full(&stack)) {
+      return false;
+    }
+
+    push(&stack, *next_point);
+  }
+
+  const Point last_point = pop(&stack);
+
+  // a convex set of the anchor point and a single other point is a line segment, unless both are the same point
+  if (stack.top > 0 ? orientation(top(&stack), &last_point, anchor_point) > 0
+                    : !is_same_point(&last_point, anchor_point)) {
+    push(&stack, last_point);
+  }
+
+  *convex_point_cnt = stack.top + 1;
+
+  return true;
+}
+
+/**
+ * @brief Checks points already sorted around the anchor point one-by-one for the direction of the angle they form, in
+ * place.
+ * @details This is the last phase of a Graham scan. Instead of pushing copies into a separate stack, the sorted array's
+ * prefix is used as the stack, so the convex set ends up at the front of the array and no extra memory is needed.
+ * @param[in,out] points The sorted points to check. This will be mutated to start with the points from the created
+ * convex set.
+ * @param point_cnt The number of points to check. This must be at least three.
+ * @param[in] anchor_point The anchor point the points were sorted around.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t scan_sorted_points_in_place(Point* const points, const size_t point_cnt, const Point* const anchor_point) {
+  size_t convex_point_cnt = 2;
+
+  for (size_t i = 2; i < point_cnt; i++) {
+    const Point next_point = points[i];
+
+    while (convex_point_cnt > 1 &&
+           orientation(&points[convex_point_cnt - 2], &points[convex_point_cnt - 1], &next_point) <= 0) {
+      convex_point_cnt--;
+    }
+
+    // the convex set never outgrows the points already checked, so this never overwrites an unchecked point
+    points[convex_point_cnt++] = next_point;
+  }
+
+  const Point* const last_point = &points[convex_point_cnt - 1];
+
+  // a convex set of the anchor point and a single other point is a line segment, unless both are the same point
+  if (convex_point_cnt > 2 ? orientation(&points[convex_point_cnt - 2], last_point, anchor_point) <= 0
+                           : is_same_point(last_point, anchor_point)) {
+    convex_point_cnt--;
+  }
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Finds the convex set of fewer than three points in place.
+ * @details These are too few for the phases of a Graham scan, but their convex set is in the same order. A duplicate
+ * point is removed, and the point with the lowest y-coordinate, and lowest x-coordinate if multiple, comes first.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan. This must be less than three.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t scan_degenerate_points_in_place(Point* const points, const size_t point_cnt) {
+  if (point_cnt < 2) {
+    return point_cnt;
+  }
+
+  if (is_same_point(&points[0], &points[1])) {
+    return 1;
+  }
+
+  if (points[1].y < points[0].y || (points[1].y == points[0].y && points[1].x < points[0].x)) {
+    swap(&points[0], &points[1]);
+  }
+
+  return 2;
+}
+
+/**
+ * @brief Finds the convex set of fewer than three points into a caller-owned array.
+ * @details This finds the convex set with `scan_degenerate_points_in_place`, then copies it into the array.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan. This must be less than three.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_cnt The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_cnt` always fits.
+ */
+bool scan_degenerate_points_into(Point* const points, const size_t point_cnt, Point* const convex_points,
+                                 const size_t convex_point_capacity, size_t* const convex_point_cnt) {
+  const size_t degenerate_point_cnt = scan_degenerate_points_in_place(points, point_cnt);
+
+  if (convex_point_capacity < degenerate_point_cnt) {
+    return false;
+  }
+
+  for (size_t i = 0; i < degenerate_point_cnt; i++) {
+    convex_points[i] = points[i];
+  }
+
+  *convex_point_cnt = degenerate_point_cnt;
+
+  return true;
+}
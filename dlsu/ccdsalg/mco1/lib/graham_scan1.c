@@ -18,62 +18,76 @@
 
 #include "convex_hull/graham_scan1.h"
 
+#include "convex_hull/graham_scan.h"
 #include "convex_hull/sort.h"
-#include "convex_hull/stack.h"
 
 /**
- * @brief Scans points to find the points that would make up the convex hull using a slower sorting algorithm.
+ * @brief Scans points to find the points that would make up the convex hull into a caller-owned array using a slower
+ * sorting algorithm.
  * @details This locates the point with the lowest y-coordinate, and lowest x-coordinate if multiple, and sets it as the
  * anchor point. The points are sorted using the selection sort algorithm. Then, they are checked one-by-one for the
  * direction of the angle they form. All points starting from the anchor point that have a counter-clockwise direction
- * form the convex hull.
+ * form the convex hull. This never allocates. The array doubles as the scan's stack, so it must fit every point the
+ * scan has yet to reject.
  * @param[in,out] points The points to scan. This will be mutated to be sorted.
  * @param point_cnt The number of points to scan.
- * @param[out] convex_points The points from the created convex set.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
  * @param[out] convex_point_cnt The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_cnt` always fits.
  */
-void slow_scan(Point* const points, const size_t point_cnt, Point** const convex_points,
-               size_t* const convex_point_cnt) {
-  size_t anchor_point_idx = 0;
-
-  for (size_t i = 1; i < point_cnt; i++) {
-    const Point* const anchor_pt = &points[anchor_point_idx];
-    const Point* const pt = &points[i];
-
-    if (pt->y < anchor_pt->y || (pt->y == anchor_pt->y && pt->x < anchor_pt->x)) {
-      anchor_point_idx = i;
-    }
+bool slow_scan_into(Point* const points, const size_t point_cnt, Point* const convex_points,
+                    const size_t convex_point_capacity, size_t* const convex_point_cnt) {
+  if (point_cnt < 3) {
+    return scan_degenerate_points_into(points, point_cnt, convex_points, convex_point_capacity, convex_point_cnt);
   }
 
-  const Point anchor_pt = points[anchor_point_idx];
-
-  selection_sort(points, point_cnt, &anchor_pt);
-
-  Stack stack;
+  const Point anchor_point = find_anchor_point(points, point_cnt);
 
-  create(&stack);
+  selection_sort(points, point_cnt, &anchor_point);
 
-  push(&stack, points[0]);
-  push(&stack, points[1]);
+  return scan_sorted_points_into(points, point_cnt, &anchor_point, convex_points, convex_point_capacity,
+                                 convex_point_cnt);
+}
 
-  for (size_t i = 2; i < point_cnt; i++) {
-    Point curr_point = pop(&stack);
-    const Point* const next_point = &points[i];
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using a slower sorting algorithm.
+ * @details This locates the point with the lowest y-coordinate, and lowest x-coordinate if multiple, and sets it as the
+ * anchor point. The points are sorted using the selection sort algorithm. Then, they are checked one-by-one for the
+ * direction of the angle they form. Instead of pushing copies into a separate stack, the sorted array's prefix is used
+ * as the stack, so the convex set ends up at the front of the array and no extra memory is needed.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t slow_scan_in_place(Point* const points, const size_t point_cnt) {
+  if (point_cnt < 3) {
+    return scan_degenerate_points_in_place(points, point_cnt);
+  }
 
-    while (!is_empty(&stack) && orientation(top(&stack), &curr_point, next_point) <= 0) {
-      curr_point = pop(&stack);
-    }
+  const Point anchor_point = find_anchor_point(points, point_cnt);
 
-    push(&stack, curr_point);
-    push(&stack, *next_point);
-  }
+  selection_sort(points, point_cnt, &anchor_point);
 
-  const Point last_point = pop(&stack);
+  return scan_sorted_points_in_place(points, point_cnt, &anchor_point);
+}
 
-  if (orientation(top(&stack), &last_point, &anchor_pt) > 0) {
-    push(&stack, last_point);
+/**
+ * @brief Scans points to find the points that would make up the convex hull using a slower sorting algorithm.
+ * @details This locates the point with the lowest y-coordinate, and lowest x-coordinate if multiple, and sets it as the
+ * anchor point. The points are sorted using the selection sort algorithm. Then, they are checked one-by-one for the
+ * direction of the angle they form. All points starting from the anchor point that have a counter-clockwise direction
+ * form the convex hull. The convex set's buffer is only grown when it can't contain all of the points, so reusing the
+ * same buffer across scans stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param[out] convex_points The points from the created convex set.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool slow_scan(PointBuffer* const points, PointBuffer* const convex_points) {
+  if (!reserve_points(convex_points, points->count)) {
+    return false;
   }
 
-  *convex_points = stack.elements;
-  *convex_point_cnt = stack.top + 1;
+  return slow_scan_into(points->elements, points->count, convex_points->elements, convex_points->capacity,
+                        &convex_points->count);
 }
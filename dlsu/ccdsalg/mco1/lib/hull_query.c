@@ -0,0 +1,279 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/hull_query.h"
+
+#include "convex_hull/kernels.h"
+
+#if HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Gets a point of a convex hull from its index.
+ * @param[in] query The index of the convex hull to use.
+ * @param point_idx The index of the point, where the anchor is zero.
+ * @return The point of the convex hull.
+ */
+static Point get_hull_point(const HullQuery* const query, const size_t point_idx) {
+  const Point point = {query->points.x[point_idx], query->points.y[point_idx]};
+
+  return point;
+}
+
+/**
+ * @brief Builds the index of a convex hull.
+ * @details The points must be in the same order as the Graham scans: counter-clockwise, starting from the point with
+ * the lowest y-coordinate, and lowest x-coordinate if multiple, without collinear points. The convex hull can have
+ * fewer than three points, in which case it is a single point, a line segment, or empty.
+ * @relates HullQuery
+ * @param[in,out] query The index to build.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @return Whether the index could be allocated.
+ */
+bool create_hull_query(HullQuery* const query, const Point* const convex_points, const size_t convex_point_cnt) {
+  create_point_soa(&query->points);
+
+  return copy_points_to_soa(&query->points, convex_points, convex_point_cnt);
+}
+
+/**
+ * @brief Checks if a point is inside a convex hull, including its boundary.
+ * @details Every orientation is calculated with `orientation`, so points on the boundary are always included.
+ * @relates HullQuery
+ * @param[in] query The index of the convex hull to use.
+ * @param[in] point The point to check.
+ * @return Whether the point is inside the convex hull or on its boundary.
+ */
+bool is_point_inside_hull(const HullQuery* const query, const Point* const point) {
+  const size_t point_cnt = query->points.count;
+
+  if (point_cnt == 0) {
+    return false;
+  }
+
+  const Point anchor = get_hull_point(query, 0);
+
+  if (point_cnt == 1) {
+    return point->x == anchor.x && point->y == anchor.y;
+  }
+
+  const Point first = get_hull_point(query, 1);
+
+  if (point_cnt == 2) {
+    return orientation(&anchor, &first, point) == 0 &&
+           (anchor.x < first.x ? anchor.x <= point->x && point->x <= first.x
+                               : first.x <= point->x && point->x <= anchor.x) &&
+           anchor.y <= point->y && point->y <= first.y;
+  }
+
+  const Point last = get_hull_point(query, point_cnt - 1);
+
+  if (orientation(&anchor, &first, point) < 0 || orientation(&anchor, &last, point) > 0) {
+    return false;
+  }
+
+  // the fan's edges are sorted by their angles, so the point is counter-clockwise from a prefix of them
+  size_t base_idx = 1;
+  size_t length = point_cnt - 2;
+
+  while (length > 1) {
+    const size_t half = length / 2;
+    const Point edge_end = get_hull_point(query, base_idx + half);
+
+    if (orientation(&anchor, &edge_end, point) >= 0) {
+      base_idx += half;
+    }
+
+    length -= half;
+  }
+
+  const Point edge_start = get_hull_point(query, base_idx);
+  const Point edge_end = get_hull_point(query, base_idx + 1);
+
+  return orientation(&edge_start, &edge_end, point) >= 0;
+}
+
+/**
+ * @brief Checks which points of a range are inside a convex hull one at a time.
+ * @param[in] query The index of the convex hull to use.
+ * @param[in] points The points to check.
+ * @param start_idx The index of the first point of the range.
+ * @param[in,out] is_inside_mask Whether each point is inside the convex hull. The range's bits must be cleared.
+ */
+static void scalar_find_points_inside_hull(const HullQuery* const query, const PointSoA* const points,
+                                           const size_t start_idx, uint64_t* const is_inside_mask) {
+  for (size_t i = start_idx; i < points->count; i++) {
+    const Point point = {points->x[i], points->y[i]};
+    const bool is_inside = is_point_inside_hull(query, &point);
+
+    is_inside_mask[i / HULL_QUERY_MASK_BITS] |= (uint64_t)is_inside << (i % HULL_QUERY_MASK_BITS);
+  }
+}
+
+#if HAS_X86_KERNELS
+
+/**
+ * @brief Calculates the cross products of four vectors at a time with four other vectors.
+ * @details The cross products whose products nearly cancel out are flagged like `orientation` would recalculate them,
+ * since the vectors are rounded differences of points like `orientation`'s.
+ * @param edge_x The x-coordinates of the vectors.
+ * @param edge_y The y-coordinates of the vectors.
+ * @param delta_x The x-coordinates of the other vectors.
+ * @param delta_y The y-coordinates of the other vectors.
+ * @param[in,out] uncertain_lanes The lanes whose cross products are too close to zero for their signs to be trusted,
+ * which this adds to.
+ * @return The cross products, positive where the other vector is counter-clockwise from the vector.
+ */
+__attribute__((target("avx2"))) static __m256d avx2_cross(const __m256d edge_x, const __m256d edge_y,
+                                                            const __m256d delta_x, const __m256d delta_y,
+                                                            __m256d* const uncertain_lanes) {
+  const __m256d sign_mask = _mm256_set1_pd(-0.0);
+  const __m256d left_product = _mm256_mul_pd(edge_x, delta_y);
+  const __m256d right_product = _mm256_mul_pd(edge_y, delta_x);
+  const __m256d magnitude =
+      _mm256_add_pd(_mm256_andnot_pd(sign_mask, left_product), _mm256_andnot_pd(sign_mask, right_product));
+  const __m256d cross = _mm256_sub_pd(left_product, right_product);
+  const __m256d error_bound = _mm256_mul_pd(_mm256_set1_pd(ORIENTATION_ERROR_BOUND), magnitude);
+
+  *uncertain_lanes = _mm256_or_pd(
+      *uncertain_lanes, _mm256_cmp_pd(_mm256_andnot_pd(sign_mask, cross), error_bound, _CMP_LT_OQ));
+
+  return cross;
+}
+
+/**
+ * @brief Checks which points of a batch are inside a convex hull of at least three points four at a time.
+ * @details Every lane runs the same binary search as `is_point_inside_hull`, so the lanes always take the same number
+ * of steps, and each step gathers the fan edge of every lane at once. The lanes where any cross product was too close
+ * to zero to trust are checked again with `is_point_inside_hull`.
+ * @param[in] query The index of the convex hull to use.
+ * @param[in] points The points to check.
+ * @param[out] is_inside_mask Whether each point is inside the convex hull. Its words must be cleared.
+ */
+__attribute__((target("avx2"))) static void avx2_find_points_inside_hull(const HullQuery* const query,
+                                                                           const PointSoA* const points,
+                                                                           uint64_t* const is_inside_mask) {
+  const double* const hull_x = query->points.x;
+  const double* const hull_y = query->points.y;
+  const size_t point_cnt = query->points.count;
+  const __m256d anchor_x = _mm256_set1_pd(hull_x[0]);
+  const __m256d anchor_y = _mm256_set1_pd(hull_y[0]);
+  const __m256d first_x = _mm256_set1_pd(hull_x[1] - hull_x[0]);
+  const __m256d first_y = _mm256_set1_pd(hull_y[1] - hull_y[0]);
+  const __m256d last_x = _mm256_set1_pd(hull_x[point_cnt - 1] - hull_x[0]);
+  const __m256d last_y = _mm256_set1_pd(hull_y[point_cnt - 1] - hull_y[0]);
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256i one = _mm256_set1_epi64x(1);
+  size_t i = 0;
+
+  for (; i + 4 <= points->count; i += 4) {
+    const __m256d x = _mm256_loadu_pd(&points->x[i]);
+    const __m256d y = _mm256_loadu_pd(&points->y[i]);
+    const __m256d delta_x = _mm256_sub_pd(x, anchor_x);
+    const __m256d delta_y = _mm256_sub_pd(y, anchor_y);
+    __m256d uncertain_lanes = zero;
+    const __m256d is_after_first =
+        _mm256_cmp_pd(avx2_cross(first_x, first_y, delta_x, delta_y, &uncertain_lanes), zero, _CMP_GE_OQ);
+    const __m256d is_before_last =
+        _mm256_cmp_pd(avx2_cross(last_x, last_y, delta_x, delta_y, &uncertain_lanes), zero, _CMP_LE_OQ);
+    __m256i base_idxs = one;
+
+    for (size_t length = point_cnt - 2; length > 1;) {
+      const size_t half = length / 2;
+      const __m256i mid_idxs = _mm256_add_epi64(base_idxs, _mm256_set1_epi64x((long long)half));
+      const __m256d edge_x = _mm256_sub_pd(_mm256_i64gather_pd(hull_x, mid_idxs, 8), anchor_x);
+      const __m256d edge_y = _mm256_sub_pd(_mm256_i64gather_pd(hull_y, mid_idxs, 8), anchor_y);
+      const __m256d is_after =
+          _mm256_cmp_pd(avx2_cross(edge_x, edge_y, delta_x, delta_y, &uncertain_lanes), zero, _CMP_GE_OQ);
+
+      base_idxs = _mm256_castpd_si256(
+          _mm256_blendv_pd(_mm256_castsi256_pd(base_idxs), _mm256_castsi256_pd(mid_idxs), is_after));
+      length -= half;
+    }
+
+    const __m256d start_x = _mm256_i64gather_pd(hull_x, base_idxs, 8);
+    const __m256d start_y = _mm256_i64gather_pd(hull_y, base_idxs, 8);
+    const __m256i end_idxs = _mm256_add_epi64(base_idxs, one);
+    const __m256d edge_x = _mm256_sub_pd(_mm256_i64gather_pd(hull_x, end_idxs, 8), start_x);
+    const __m256d edge_y = _mm256_sub_pd(_mm256_i64gather_pd(hull_y, end_idxs, 8), start_y);
+    const __m256d is_inside_edge = _mm256_cmp_pd(
+        avx2_cross(edge_x, edge_y, _mm256_sub_pd(x, start_x), _mm256_sub_pd(y, start_y), &uncertain_lanes), zero,
+        _CMP_GE_OQ);
+    const int uncertain_mask = _mm256_movemask_pd(uncertain_lanes);
+    int inside_mask = _mm256_movemask_pd(_mm256_and_pd(_mm256_and_pd(is_after_first, is_before_last), is_inside_edge));
+
+    for (int j = 0; uncertain_mask != 0 && j < 4; j++) {
+      if (uncertain_mask >> j & 1) {
+        const Point point = {points->x[i + (size_t)j], points->y[i + (size_t)j]};
+
+        inside_mask = (inside_mask & ~(1 << j)) | (int)is_point_inside_hull(query, &point) << j;
+      }
+    }
+
+    // four results never straddle two words, since the words hold a multiple of four bits
+    is_inside_mask[i / HULL_QUERY_MASK_BITS] |= (uint64_t)inside_mask << (i % HULL_QUERY_MASK_BITS);
+  }
+
+  scalar_find_points_inside_hull(query, points, i, is_inside_mask);
+}
+
+#endif
+
+/**
+ * @brief Checks which points of a batch are inside a convex hull, including its boundary.
+ * @details The result of the point at index `i` is stored in bit `i % HULL_QUERY_MASK_BITS` of the mask's word at index
+ * `i / HULL_QUERY_MASK_BITS`. With AVX2, four points are searched at a time, with their fan edges gathered from the
+ * index. The orientations are calculated with doubles like the other batch kernels, and the points whose orientations
+ * are too close to call are checked with `is_point_inside_hull`, so every result is the same as its.
+ * @relates HullQuery
+ * @param[in] query The index of the convex hull to use.
+ * @param[in] points The points to check.
+ * @param[out] is_inside_mask Whether each point is inside the convex hull. This must be able to contain
+ * `HULL_QUERY_MASK_WORD_COUNT(points->count)` words.
+ */
+void find_points_inside_hull(const HullQuery* const query, const PointSoA* const points,
+                             uint64_t* const is_inside_mask) {
+  const size_t word_cnt = HULL_QUERY_MASK_WORD_COUNT(points->count);
+
+  for (size_t i = 0; i < word_cnt; i++) {
+    is_inside_mask[i] = 0;
+  }
+
+#if HAS_X86_KERNELS
+  // every lane searches a different fan edge, which only AVX2 can gather in a single instruction
+  if (get_instruction_set() == AVX2_INSTRUCTION_SET && query->points.count >= 3) {
+    avx2_find_points_inside_hull(query, points, is_inside_mask);
+
+    return;
+  }
+#endif
+
+  scalar_find_points_inside_hull(query, points, 0, is_inside_mask);
+}
+
+/**
+ * @brief Frees the index of a convex hull.
+ * @details This resets the index to an empty convex hull, so it can be reused.
+ * @relates HullQuery
+ * @param[in,out] query The index to free.
+ */
+void destroy_hull_query(HullQuery* const query) {
+  destroy_point_soa(&query->points);
+}
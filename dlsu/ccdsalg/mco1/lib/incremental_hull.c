@@ -0,0 +1,491 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/incremental_hull.h"
+
+#include <stdlib.h>
+
+/** @brief The index that refers to no node. */
+#define NO_NODE SIZE_MAX
+
+/** @brief The number of nodes a hull chain can contain after its first allocation. */
+#define MIN_HULL_CHAIN_CAPACITY 16
+
+/** @brief The seed of the generator of the nodes' priorities. */
+#define HULL_CHAIN_SEED 2463534242u
+
+/** @brief The direction of the turns between consecutive points of the lower chain, which is counter-clockwise. */
+#define LOWER_CHAIN_SIDE 1
+
+/** @brief The direction of the turns between consecutive points of the upper chain, which is clockwise. */
+#define UPPER_CHAIN_SIDE (-1)
+
+/**
+ * @brief Checks if a point comes before another point when ordered by their x-coordinates, and y-coordinates if
+ * multiple.
+ * @param[in] a The point to check.
+ * @param[in] b The point to check against.
+ * @return Whether point `a` comes before point `b`.
+ */
+static bool is_before(const Point* const a, const Point* const b) {
+  return a->x < b->x || (a->x == b->x && a->y < b->y);
+}
+
+/**
+ * @brief Initializes a hull chain to be empty.
+ * @param[in,out] chain The hull chain to initialize.
+ */
+static void create_hull_chain(HullChain* const chain) {
+  chain->nodes = NULL;
+  chain->root = NO_NODE;
+  chain->count = 0;
+  chain->capacity = 0;
+  chain->used_count = 0;
+  chain->free_node = NO_NODE;
+  chain->random_state = HULL_CHAIN_SEED;
+}
+
+/**
+ * @brief Allocates a node for a point, reusing a freed node if there is one.
+ * @param[in,out] chain The hull chain to allocate from.
+ * @param point The point of the node.
+ * @return The index of the node, or `NO_NODE` if the nodes couldn't be grown.
+ */
+static size_t allocate_node(HullChain* const chain, const Point point) {
+  size_t node_idx = chain->free_node;
+
+  if (node_idx != NO_NODE) {
+    chain->free_node = chain->nodes[node_idx].right;
+  } else {
+    if (chain->used_count == chain->capacity) {
+      if (chain->capacity > SIZE_MAX / 2 / sizeof(HullChainNode)) {
+        return NO_NODE;
+      }
+
+      const size_t new_capacity = chain->capacity < MIN_HULL_CHAIN_CAPACITY ? MIN_HULL_CHAIN_CAPACITY
+                                                                             : chain->capacity * 2;
+      HullChainNode* const new_nodes = realloc(chain->nodes, new_capacity * sizeof(HullChainNode));
+
+      if (!new_nodes) {
+        return NO_NODE;
+      }
+
+      chain->nodes = new_nodes;
+      chain->capacity = new_capacity;
+    }
+
+    node_idx = chain->used_count++;
+  }
+
+  // xorshift32, so the treap's shape never depends on the order of the points
+  chain->random_state ^= chain->random_state << 13;
+  chain->random_state ^= chain->random_state >> 17;
+  chain->random_state ^= chain->random_state << 5;
+
+  HullChainNode* const node = &chain->nodes[node_idx];
+
+  node->point = point;
+  node->left = NO_NODE;
+  node->right = NO_NODE;
+  node->priority = chain->random_state;
+
+  return node_idx;
+}
+
+/**
+ * @brief Splits a treap into the nodes before a point and the rest.
+ * @param[in,out] chain The hull chain of the treap.
+ * @param root_idx The index of the treap's root node.
+ * @param[in] point The point to split at.
+ * @param is_inclusive Whether a node equal to the point goes to the first treap instead of the second.
+ * @param[out] left_idx The index of the root node of the nodes before the point.
+ * @param[out] right_idx The index of the root node of the rest.
+ */
+static void split(HullChain* const chain, const size_t root_idx, const Point* const point, const bool is_inclusive,
+                  size_t* const left_idx, size_t* const right_idx) {
+  if (root_idx == NO_NODE) {
+    *left_idx = NO_NODE;
+    *right_idx = NO_NODE;
+
+    return;
+  }
+
+  HullChainNode* const root = &chain->nodes[root_idx];
+  const bool is_root_left = is_inclusive ? !is_before(point, &root->point) : is_before(&root->point, point);
+
+  if (is_root_left) {
+    split(chain, root->right, point, is_inclusive, &root->right, right_idx);
+
+    *left_idx = root_idx;
+  } else {
+    split(chain, root->left, point, is_inclusive, left_idx, &root->left);
+
+    *right_idx = root_idx;
+  }
+}
+
+/**
+ * @brief Joins two treaps, where every node of the first comes before every node of the second.
+ * @param[in,out] chain The hull chain of the treaps.
+ * @param left_idx The index of the first treap's root node.
+ * @param right_idx The index of the second treap's root node.
+ * @return The index of the joined treap's root node.
+ */
+static size_t merge(HullChain* const chain, const size_t left_idx, const size_t right_idx) {
+  if (left_idx == NO_NODE) {
+    return right_idx;
+  }
+
+  if (right_idx == NO_NODE) {
+    return left_idx;
+  }
+
+  HullChainNode* const left = &chain->nodes[left_idx];
+  HullChainNode* const right = &chain->nodes[right_idx];
+
+  if (left->priority > right->priority) {
+    left->right = merge(chain, left->right, right_idx);
+
+    return left_idx;
+  }
+
+  right->left = merge(chain, left_idx, right->left);
+
+  return right_idx;
+}
+
+/**
+ * @brief Locates the last point of a hull chain that comes before a point.
+ * @param[in] chain The hull chain to search.
+ * @param[in] point The point to search around.
+ * @return The index of the node of the preceding point, or `NO_NODE` if there is none.
+ */
+static size_t find_predecessor(const HullChain* const chain, const Point* const point) {
+  size_t predecessor_idx = NO_NODE;
+  size_t node_idx = chain->root;
+
+  while (node_idx != NO_NODE) {
+    const HullChainNode* const node = &chain->nodes[node_idx];
+
+    if (is_before(&node->point, point)) {
+      predecessor_idx = node_idx;
+      node_idx = node->right;
+    } else {
+      node_idx = node->left;
+    }
+  }
+
+  return predecessor_idx;
+}
+
+/**
+ * @brief Locates the first point of a hull chain that comes after a point.
+ * @param[in] chain The hull chain to search.
+ * @param[in] point The point to search around.
+ * @return The index of the node of the succeeding point, or `NO_NODE` if there is none.
+ */
+static size_t find_successor(const HullChain* const chain, const Point* const point) {
+  size_t successor_idx = NO_NODE;
+  size_t node_idx = chain->root;
+
+  while (node_idx != NO_NODE) {
+    const HullChainNode* const node = &chain->nodes[node_idx];
+
+    if (is_before(point, &node->point)) {
+      successor_idx = node_idx;
+      node_idx = node->left;
+    } else {
+      node_idx = node->right;
+    }
+  }
+
+  return successor_idx;
+}
+
+/**
+ * @brief Checks if a hull chain contains a point, given the nodes of the points around it.
+ * @details A point equal to the point is between its predecessor and successor, so it is the successor of the
+ * predecessor, or the first point of the chain if there is no predecessor.
+ * @param[in] chain The hull chain to check.
+ * @param predecessor_idx The index of the node of the point's predecessor, or `NO_NODE` if there is none.
+ * @param successor_idx The index of the node of the point's successor, or `NO_NODE` if there is none.
+ * @return Whether a point equal to the point is in the chain.
+ */
+static bool has_chain_point(const HullChain* const chain, const size_t predecessor_idx, const size_t successor_idx) {
+  if (chain->root == NO_NODE) {
+    return false;
+  }
+
+  size_t next_idx;
+
+  if (predecessor_idx != NO_NODE) {
+    next_idx = find_successor(chain, &chain->nodes[predecessor_idx].point);
+  } else {
+    next_idx = chain->root;
+
+    while (chain->nodes[next_idx].left != NO_NODE) {
+      next_idx = chain->nodes[next_idx].left;
+    }
+  }
+
+  return next_idx != successor_idx;
+}
+
+/**
+ * @brief Removes a point from a hull chain.
+ * @param[in,out] chain The hull chain to remove from.
+ * @param node_idx The index of the node of the point to remove.
+ */
+static void remove_node(HullChain* const chain, const size_t node_idx) {
+  const Point point = chain->nodes[node_idx].point;
+  size_t left_idx;
+  size_t middle_idx;
+  size_t right_idx;
+
+  split(chain, chain->root, &point, false, &left_idx, &middle_idx);
+  split(chain, middle_idx, &point, true, &middle_idx, &right_idx);
+
+  chain->root = merge(chain, left_idx, right_idx);
+  chain->count--;
+
+  chain->nodes[node_idx].right = chain->free_node;
+  chain->free_node = node_idx;
+}
+
+/**
+ * @brief Inserts a point into a hull chain if it is outside of it, removing the points it makes concave.
+ * @param[in,out] chain The hull chain to insert into.
+ * @param[in] point The point to insert.
+ * @param side The direction of the turns between consecutive points of the chain, either `LOWER_CHAIN_SIDE` or
+ * `UPPER_CHAIN_SIDE`.
+ * @return Whether the nodes could be grown to contain the point.
+ */
+static bool insert_chain_point(HullChain* const chain, const Point* const point, const int side) {
+  size_t predecessor_idx = find_predecessor(chain, point);
+  size_t successor_idx = find_successor(chain, point);
+
+  if (predecessor_idx != NO_NODE && successor_idx != NO_NODE &&
+      side * orientation(&chain->nodes[predecessor_idx].point, &chain->nodes[successor_idx].point, point) >= 0) {
+    return true;
+  }
+
+  if (has_chain_point(chain, predecessor_idx, successor_idx)) {
+    return true;
+  }
+
+  while (predecessor_idx != NO_NODE) {
+    const Point predecessor = chain->nodes[predecessor_idx].point;
+    const size_t next_predecessor_idx = find_predecessor(chain, &predecessor);
+
+    if (next_predecessor_idx == NO_NODE ||
+        side * orientation(&chain->nodes[next_predecessor_idx].point, &predecessor, point) > 0) {
+      break;
+    }
+
+    remove_node(chain, predecessor_idx);
+
+    predecessor_idx = next_predecessor_idx;
+  }
+
+  while (successor_idx != NO_NODE) {
+    const Point successor = chain->nodes[successor_idx].point;
+    const size_t next_successor_idx = find_successor(chain, &successor);
+
+    if (next_successor_idx == NO_NODE ||
+        side * orientation(point, &successor, &chain->nodes[next_successor_idx].point) > 0) {
+      break;
+    }
+
+    remove_node(chain, successor_idx);
+
+    successor_idx = next_successor_idx;
+  }
+
+  const size_t node_idx = allocate_node(chain, *point);
+
+  if (node_idx == NO_NODE) {
+    return false;
+  }
+
+  size_t left_idx;
+  size_t right_idx;
+
+  split(chain, chain->root, point, false, &left_idx, &right_idx);
+
+  chain->root = merge(chain, merge(chain, left_idx, node_idx), right_idx);
+  chain->count++;
+
+  return true;
+}
+
+/**
+ * @brief Copies the points of a treap in order.
+ * @param[in] chain The hull chain of the treap.
+ * @param root_idx The index of the treap's root node.
+ * @param[out] points The array to copy the points to.
+ * @param[in,out] point_cnt The number of points copied so far.
+ */
+static void copy_chain_points(const HullChain* const chain, const size_t root_idx, Point* const points,
+                              size_t* const point_cnt) {
+  if (root_idx == NO_NODE) {
+    return;
+  }
+
+  const HullChainNode* const root = &chain->nodes[root_idx];
+
+  copy_chain_points(chain, root->left, points, point_cnt);
+
+  points[(*point_cnt)++] = root->point;
+
+  copy_chain_points(chain, root->right, points, point_cnt);
+}
+
+/**
+ * @brief Copies the points of a treap in reverse order, skipping the chain's endpoints.
+ * @param[in] chain The hull chain of the treap.
+ * @param root_idx The index of the treap's root node.
+ * @param[out] points The array to copy the points to.
+ * @param[in,out] visit_cnt The number of points visited so far, including the skipped endpoints.
+ * @param[in,out] point_cnt The number of points copied so far.
+ */
+static void copy_chain_interior_points_reversed(const HullChain* const chain, const size_t root_idx,
+                                                Point* const points, size_t* const visit_cnt, size_t* const point_cnt) {
+  if (root_idx == NO_NODE) {
+    return;
+  }
+
+  const HullChainNode* const root = &chain->nodes[root_idx];
+
+  copy_chain_interior_points_reversed(chain, root->right, points, visit_cnt, point_cnt);
+
+  if (*visit_cnt != 0 && *visit_cnt != chain->count - 1) {
+    points[(*point_cnt)++] = root->point;
+  }
+
+  (*visit_cnt)++;
+
+  copy_chain_interior_points_reversed(chain, root->left, points, visit_cnt, point_cnt);
+}
+
+/**
+ * @brief Reverses the order of a range of points.
+ * @param[in,out] points The points to reverse.
+ * @param point_cnt The number of points to reverse.
+ */
+static void reverse(Point* const points, const size_t point_cnt) {
+  for (size_t i = 0; i < point_cnt / 2; i++) {
+    const Point temp = points[i];
+
+    points[i] = points[point_cnt - 1 - i];
+    points[point_cnt - 1 - i] = temp;
+  }
+}
+
+/**
+ * @brief Initializes an incremental convex hull to be empty.
+ * @details This doesn't allocate.
+ * @relates IncrementalHull
+ * @param[in,out] hull The incremental convex hull to initialize.
+ */
+void create_incremental_hull(IncrementalHull* const hull) {
+  create_hull_chain(&hull->lower_chain);
+  create_hull_chain(&hull->upper_chain);
+}
+
+/**
+ * @brief Inserts a point into an incremental convex hull.
+ * @details A point inside or on the boundary of the convex hull leaves it unchanged.
+ * @relates IncrementalHull
+ * @param[in,out] hull The incremental convex hull to insert into.
+ * @param point The point to insert.
+ * @return Whether the chains could be grown to contain the point.
+ */
+bool insert_incremental_hull_point(IncrementalHull* const hull, const Point point) {
+  return insert_chain_point(&hull->lower_chain, &point, LOWER_CHAIN_SIDE) &&
+         insert_chain_point(&hull->upper_chain, &point, UPPER_CHAIN_SIDE);
+}
+
+/**
+ * @brief Gets the number of points that make up an incremental convex hull.
+ * @details This takes constant time.
+ * @relates IncrementalHull
+ * @param[in] hull The incremental convex hull to use.
+ * @return The number of points from the convex set.
+ */
+size_t get_incremental_hull_point_count(const IncrementalHull* const hull) {
+  const size_t lower_point_cnt = hull->lower_chain.count;
+
+  // both chains share their endpoints, which are the same point if every point is equal
+  return lower_point_cnt < 2 ? lower_point_cnt : lower_point_cnt + hull->upper_chain.count - 2;
+}
+
+/**
+ * @brief Copies the points that make up an incremental convex hull into a caller-owned array.
+ * @details The points are in the same order as the Graham scans: counter-clockwise, starting from the point with the
+ * lowest y-coordinate, and lowest x-coordinate if multiple. This takes linear time in the size of the convex hull.
+ * @relates IncrementalHull
+ * @param[in] hull The incremental convex hull to use.
+ * @param[out] convex_points The array to copy the points from the convex set to. This must be able to contain
+ * `get_incremental_hull_point_count` points.
+ * @return The number of points from the convex set.
+ */
+size_t copy_incremental_hull_points(const IncrementalHull* const hull, Point* const convex_points) {
+  const size_t hull_cnt = get_incremental_hull_point_count(hull);
+  size_t convex_point_cnt = 0;
+  size_t visit_cnt = 0;
+
+  copy_chain_points(&hull->lower_chain, hull->lower_chain.root, convex_points, &convex_point_cnt);
+
+  const size_t lower_point_cnt = convex_point_cnt;
+
+  if (hull_cnt > 2) {
+    copy_chain_interior_points_reversed(&hull->upper_chain, hull->upper_chain.root, convex_points, &visit_cnt,
+                                        &convex_point_cnt);
+  }
+
+  // the anchor point is always on the lower chain, and rotating the points makes it the first
+  size_t anchor_point_idx = 0;
+
+  for (size_t i = 1; i < lower_point_cnt; i++) {
+    const Point* const anchor_point = &convex_points[anchor_point_idx];
+    const Point* const pt = &convex_points[i];
+
+    if (pt->y < anchor_point->y || (pt->y == anchor_point->y && pt->x < anchor_point->x)) {
+      anchor_point_idx = i;
+    }
+  }
+
+  reverse(convex_points, anchor_point_idx);
+  reverse(&convex_points[anchor_point_idx], convex_point_cnt - anchor_point_idx);
+  reverse(convex_points, convex_point_cnt);
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Frees the chains of an incremental convex hull.
+ * @details This resets the convex hull to be empty, so it can be reused.
+ * @relates IncrementalHull
+ * @param[in,out] hull The incremental convex hull to free.
+ */
+void destroy_incremental_hull(IncrementalHull* const hull) {
+  free(hull->lower_chain.nodes);
+  free(hull->upper_chain.nodes);
+
+  create_incremental_hull(hull);
+}
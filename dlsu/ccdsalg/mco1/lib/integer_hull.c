@@ -0,0 +1,428 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/integer_hull.h"
+
+#include <stdlib.h>
+
+/** @brief The number of bits sorted by each pass of the radix sort. */
+#define RADIX_BITS 11
+
+/** @brief The number of buckets of each pass of the radix sort. */
+#define RADIX_BUCKET_COUNT (1 << RADIX_BITS)
+
+/** @brief The number of passes needed to sort a 64-bit key. */
+#define RADIX_PASS_COUNT ((64 + RADIX_BITS - 1) / RADIX_BITS)
+
+/** @brief The offset that maps a 32-bit integer coordinate to an unsigned one that orders like it. */
+#define COORDINATE_OFFSET INT64_C(2147483648)
+
+#ifdef __SIZEOF_INT128__
+/** @brief A signed integer that can contain the product of two coordinates' differences. */
+__extension__ typedef __int128 WideInteger;
+#endif
+
+/**
+ * @brief Converts points into integer points.
+ * @details This only succeeds if every coordinate is an integer that fits into 32 bits, so the conversion is exact.
+ * @param[in] points The points to convert.
+ * @param point_cnt The number of points to convert.
+ * @param[out] integer_points The array to write the integer points to.
+ * @return Whether every coordinate could be converted exactly.
+ */
+bool to_integer_points(const Point* const points, const size_t point_cnt, IntegerPoint* const integer_points) {
+  for (size_t i = 0; i < point_cnt; i++) {
+    const Point* const point = &points[i];
+
+    // the range checks come first, since converting a double outside of the range is undefined
+    if (!(point->x >= INT32_MIN && point->x <= INT32_MAX && point->y >= INT32_MIN && point->y <= INT32_MAX)) {
+      return false;
+    }
+
+    integer_points[i].x = (int32_t)point->x;
+    integer_points[i].y = (int32_t)point->y;
+
+    if (integer_points[i].x != point->x || integer_points[i].y != point->y) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Converts integer points back into points.
+ * @param[in] integer_points The integer points to convert.
+ * @param point_cnt The number of points to convert.
+ * @param[out] points The array to write the points to.
+ */
+void from_integer_points(const IntegerPoint* const integer_points, const size_t point_cnt, Point* const points) {
+  for (size_t i = 0; i < point_cnt; i++) {
+    points[i].x = integer_points[i].x;
+    points[i].y = integer_points[i].y;
+  }
+}
+
+#ifndef __SIZEOF_INT128__
+/**
+ * @brief Calculates the sign of an integer.
+ * @param value The integer to use.
+ * @return `-1` if the integer is negative, `1` if positive, or `0` if zero.
+ */
+static int sign(const int64_t value) { return (value > 0) - (value < 0); }
+
+/**
+ * @brief Compares the products of two pairs of coordinates' differences exactly.
+ * @details Every difference has a magnitude below `2^32`, so the magnitude of every product fits into an unsigned
+ * 64-bit integer. The products are compared by their signs first, and by their magnitudes if the signs are equal.
+ * @param a The first factor of the first product.
+ * @param b The second factor of the first product.
+ * @param c The first factor of the second product.
+ * @param d The second factor of the second product.
+ * @return `-1` if the first product is smaller, `1` if larger, or `0` if equal.
+ */
+static int compare_products(const int64_t a, const int64_t b, const int64_t c, const int64_t d) {
+  const int first_sign = sign(a) * sign(b);
+  const int second_sign = sign(c) * sign(d);
+
+  if (first_sign != second_sign) {
+    return first_sign < second_sign ? -1 : 1;
+  }
+
+  const uint64_t first_magnitude = (uint64_t)(a < 0 ? -a : a) * (uint64_t)(b < 0 ? -b : b);
+  const uint64_t second_magnitude = (uint64_t)(c < 0 ? -c : c) * (uint64_t)(d < 0 ? -d : d);
+  const int magnitude_order = (first_magnitude > second_magnitude) - (first_magnitude < second_magnitude);
+
+  return first_sign < 0 ? -magnitude_order : magnitude_order;
+}
+#endif
+
+/**
+ * @brief Calculates the orientation of the angle formed by connecting three integer points exactly.
+ * @details This uses the cross product of the two vectors formed by the three points, like `orientation`. The
+ * coordinates' differences take 33 bits, so their products are calculated with 128-bit integers when the compiler
+ * supports them. Otherwise, each product's magnitude fits into an unsigned 64-bit integer, and the two products are
+ * compared by their signs and magnitudes. Either way, there is no rounding, so collinear points are always detected.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @param[in] b The third point to use.
+ * @return `-1` if the angle is clockwise, `1` if counter-clockwise, or `0` if collinear.
+ */
+int integer_orientation(const IntegerPoint* const a, const IntegerPoint* const vertex, const IntegerPoint* const b) {
+  const int64_t vertex_dx = (int64_t)vertex->x - a->x;
+  const int64_t vertex_dy = (int64_t)vertex->y - a->y;
+  const int64_t b_dx = (int64_t)b->x - a->x;
+  const int64_t b_dy = (int64_t)b->y - a->y;
+
+#ifdef __SIZEOF_INT128__
+  const WideInteger cross_product = (WideInteger)vertex_dx * b_dy - (WideInteger)vertex_dy * b_dx;
+
+  return (cross_product > 0) - (cross_product < 0);
+#else
+  return compare_products(vertex_dx, b_dy, vertex_dy, b_dx);
+#endif
+}
+
+/**
+ * @brief Packs an integer point into a key that orders like the point when compared as an unsigned integer.
+ * @param[in] point The point to pack.
+ * @return The key of the point.
+ */
+static uint64_t to_key(const IntegerPoint* const point) {
+  return (uint64_t)(point->x + COORDINATE_OFFSET) << 32 | (uint64_t)(point->y + COORDINATE_OFFSET);
+}
+
+/**
+ * @brief Unpacks an integer point from its key.
+ * @param key The key to unpack.
+ * @return The point of the key.
+ */
+static IntegerPoint from_key(const uint64_t key) {
+  const IntegerPoint point = {(int32_t)((int64_t)(key >> 32) - COORDINATE_OFFSET),
+                              (int32_t)((int64_t)(key & UINT32_MAX) - COORDINATE_OFFSET)};
+
+  return point;
+}
+
+/**
+ * @brief Checks if an integer point is lexicographically larger than another integer point.
+ * @param[in] a The point to check.
+ * @param[in] b The point to check against.
+ * @return Whether point `a` is lexicographically larger than point `b`.
+ */
+static bool is_larger(const IntegerPoint* const a, const IntegerPoint* const b) {
+  return a->x > b->x || (a->x == b->x && a->y > b->y);
+}
+
+/**
+ * @brief Swaps two integer points.
+ * @param[in,out] a The first point to swap.
+ * @param[in,out] b The second point to swap.
+ */
+static void swap_integer_points(IntegerPoint* const a, IntegerPoint* const b) {
+  const IntegerPoint temp = *a;
+  *a = *b;
+  *b = temp;
+}
+
+/**
+ * @brief Turns a subtree of integer points into a max heap of their lexicographic order.
+ * @param[in,out] points The points of the heap.
+ * @param point_cnt The number of points of the heap.
+ * @param parent_idx The index of the subtree's root.
+ */
+static void heapify(IntegerPoint* const points, const size_t point_cnt, size_t parent_idx) {
+  while (true) {
+    const size_t left_idx = 2 * parent_idx + 1;
+    const size_t right_idx = left_idx + 1;
+    size_t largest_idx = parent_idx;
+
+    if (left_idx < point_cnt && is_larger(&points[left_idx], &points[largest_idx])) {
+      largest_idx = left_idx;
+    }
+
+    if (right_idx < point_cnt && is_larger(&points[right_idx], &points[largest_idx])) {
+      largest_idx = right_idx;
+    }
+
+    if (largest_idx == parent_idx) {
+      return;
+    }
+
+    swap_integer_points(&points[parent_idx], &points[largest_idx]);
+
+    parent_idx = largest_idx;
+  }
+}
+
+/**
+ * @brief Sorts integer points lexicographically in ascending order using the heap sort algorithm.
+ * @details This is the fallback of `integer_radix_sort`, since it never allocates.
+ * @param[in,out] points The points to sort.
+ * @param point_cnt The number of points to sort.
+ */
+static void heap_sort(IntegerPoint* const points, const size_t point_cnt) {
+  for (size_t i = point_cnt / 2; i > 0; i--) {
+    heapify(points, point_cnt, i - 1);
+  }
+
+  for (size_t i = point_cnt - 1; point_cnt > 0 && i > 0; i--) {
+    swap_integer_points(&points[0], &points[i]);
+
+    heapify(points, i, 0);
+  }
+}
+
+/**
+ * @brief Sorts integer points by their x-coordinate or y-coordinate in ascending order using the radix sort algorithm.
+ * @details Each point's coordinates are offset to be unsigned and packed into a single 64-bit key, which orders like
+ * the point. The keys are sorted by their bits, least significant first, and unpacked back into the points. Passes
+ * where every key has the same digit are skipped, so small coordinate ranges take fewer passes.
+ * @param[in,out] points The points to sort.
+ * @param point_cnt The number of points to sort.
+ * @return Whether the memory for the keys could be allocated. The points are left unsorted if not.
+ */
+bool integer_radix_sort(IntegerPoint* const points, const size_t point_cnt) {
+  if (point_cnt < 2) {
+    return true;
+  }
+
+  if (point_cnt > SIZE_MAX / 2 / sizeof(uint64_t)) {
+    return false;
+  }
+
+  uint64_t* keys = malloc(2 * point_cnt * sizeof(uint64_t));
+  size_t* const bucket_cnts = calloc(RADIX_PASS_COUNT * RADIX_BUCKET_COUNT, sizeof(size_t));
+
+  if (!keys || !bucket_cnts) {
+    free(keys);
+    free(bucket_cnts);
+
+    return false;
+  }
+
+  uint64_t* sorted_keys = &keys[point_cnt];
+  uint64_t* const allocated_keys = keys;
+
+  // every pass's buckets are counted in a single walk over the points
+  for (size_t i = 0; i < point_cnt; i++) {
+    keys[i] = to_key(&points[i]);
+
+    for (size_t pass = 0; pass < RADIX_PASS_COUNT; pass++) {
+      bucket_cnts[pass * RADIX_BUCKET_COUNT + ((keys[i] >> (pass * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1))]++;
+    }
+  }
+
+  for (size_t pass = 0; pass < RADIX_PASS_COUNT; pass++) {
+    size_t* const pass_bucket_cnts = &bucket_cnts[pass * RADIX_BUCKET_COUNT];
+    const size_t shift = pass * RADIX_BITS;
+
+    if (pass_bucket_cnts[(keys[0] >> shift) & (RADIX_BUCKET_COUNT - 1)] == point_cnt) {
+      continue;
+    }
+
+    size_t bucket_start_idx = 0;
+
+    for (size_t i = 0; i < RADIX_BUCKET_COUNT; i++) {
+      const size_t bucket_cnt = pass_bucket_cnts[i];
+
+      pass_bucket_cnts[i] = bucket_start_idx;
+      bucket_start_idx += bucket_cnt;
+    }
+
+    for (size_t i = 0; i < point_cnt; i++) {
+      sorted_keys[pass_bucket_cnts[(keys[i] >> shift) & (RADIX_BUCKET_COUNT - 1)]++] = keys[i];
+    }
+
+    uint64_t* const swapped_keys = keys;
+
+    keys = sorted_keys;
+    sorted_keys = swapped_keys;
+  }
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    points[i] = from_key(keys[i]);
+  }
+
+  free(allocated_keys);
+  free(bucket_cnts);
+
+  return true;
+}
+
+/**
+ * @brief Reverses the order of a range of integer points.
+ * @param[in,out] points The points to reverse.
+ * @param point_cnt The number of points to reverse.
+ */
+static void reverse(IntegerPoint* const points, const size_t point_cnt) {
+  for (size_t i = 0; i < point_cnt / 2; i++) {
+    swap_integer_points(&points[i], &points[point_cnt - 1 - i]);
+  }
+}
+
+/**
+ * @brief Scans integer points to find the points that would make up the convex hull into a caller-owned array using
+ * Andrew's monotone chain algorithm.
+ * @details This sorts the points with `integer_radix_sort`, or the heap sort algorithm if the keys can't be allocated.
+ * Then, the lower and the upper halves of the convex hull are built like `monotone_chain_scan_into`, but with
+ * `integer_orientation`, so near-collinear points never make the scan unstable. The convex hull is rotated to start
+ * from the point with the lowest y-coordinate, and lowest x-coordinate if multiple, to match the order of the Graham
+ * scans. This never allocates other than the keys.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_cnt The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_cnt` always fits.
+ */
+bool integer_monotone_chain_scan_into(IntegerPoint* const points, const size_t point_cnt,
+                                      IntegerPoint* const convex_points, const size_t convex_point_capacity,
+                                      size_t* const convex_point_cnt) {
+  if (!integer_radix_sort(points, point_cnt)) {
+    heap_sort(points, point_cnt);
+  }
+
+  if (point_cnt == 0) {
+    *convex_point_cnt = 0;
+
+    return true;
+  }
+
+  const IntegerPoint* const leftmost_point = &points[0];
+  const IntegerPoint* const rightmost_point = &points[point_cnt - 1];
+
+  // duplicates of a single point would otherwise be kept as both of the halves' ends
+  if (leftmost_point->x == rightmost_point->x && leftmost_point->y == rightmost_point->y) {
+    if (convex_point_capacity < 1) {
+      return false;
+    }
+
+    convex_points[0] = *leftmost_point;
+    *convex_point_cnt = 1;
+
+    return true;
+  }
+
+  size_t hull_cnt = 0;
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    const IntegerPoint* const next_point = &points[i];
+
+    // points above the line between the leftmost and the rightmost points can only be on the upper half
+    if (integer_orientation(leftmost_point, rightmost_point, next_point) > 0) {
+      continue;
+    }
+
+    while (hull_cnt > 1 &&
+           integer_orientation(&convex_points[hull_cnt - 2], &convex_points[hull_cnt - 1], next_point) <= 0) {
+      hull_cnt--;
+    }
+
+    if (hull_cnt == convex_point_capacity) {
+      return false;
+    }
+
+    convex_points[hull_cnt++] = *next_point;
+  }
+
+  const size_t lower_hull_cnt = hull_cnt;
+
+  for (size_t i = point_cnt - 1; i > 0; i--) {
+    const IntegerPoint* const next_point = &points[i - 1];
+
+    if (i > 1 && integer_orientation(leftmost_point, rightmost_point, next_point) <= 0) {
+      continue;
+    }
+
+    while (hull_cnt > lower_hull_cnt &&
+           integer_orientation(&convex_points[hull_cnt - 2], &convex_points[hull_cnt - 1], next_point) <= 0) {
+      hull_cnt--;
+    }
+
+    // the upper half ends on the leftmost point, which already starts the lower half
+    if (i == 1) {
+      break;
+    }
+
+    if (hull_cnt == convex_point_capacity) {
+      return false;
+    }
+
+    convex_points[hull_cnt++] = *next_point;
+  }
+
+  size_t anchor_point_idx = 0;
+
+  for (size_t i = 1; i < hull_cnt; i++) {
+    const IntegerPoint* const anchor_point = &convex_points[anchor_point_idx];
+    const IntegerPoint* const pt = &convex_points[i];
+
+    if (pt->y < anchor_point->y || (pt->y == anchor_point->y && pt->x < anchor_point->x)) {
+      anchor_point_idx = i;
+    }
+  }
+
+  reverse(convex_points, anchor_point_idx);
+  reverse(&convex_points[anchor_point_idx], hull_cnt - anchor_point_idx);
+  reverse(convex_points, hull_cnt);
+
+  *convex_point_cnt = hull_cnt;
+
+  return true;
+}
@@ -0,0 +1,718 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/kernels.h"
+
+#include <stdbool.h>
+
+#if HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+/** @brief Whether an instruction set was chosen with `set_instruction_set`. */
+static bool is_instruction_set_chosen = false;
+
+/** @brief The instruction set chosen with `set_instruction_set`. */
+static InstructionSet chosen_instruction_set = SCALAR_INSTRUCTION_SET;
+
+/**
+ * @brief Gets the fastest instruction set supported by the processor.
+ * @details This is detected at runtime, so the same executable runs on processors without vector extensions.
+ * @return The fastest supported instruction set.
+ */
+InstructionSet get_supported_instruction_set(void) {
+#if HAS_X86_KERNELS
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2")) {
+    return AVX2_INSTRUCTION_SET;
+  }
+
+  if (__builtin_cpu_supports("sse2")) {
+    return SSE2_INSTRUCTION_SET;
+  }
+#endif
+
+  return SCALAR_INSTRUCTION_SET;
+}
+
+/**
+ * @brief Gets the instruction set the kernels are dispatched to.
+ * @details This defaults to the fastest supported instruction set.
+ * @return The instruction set in use.
+ */
+InstructionSet get_instruction_set(void) {
+  return is_instruction_set_chosen ? chosen_instruction_set : get_supported_instruction_set();
+}
+
+/**
+ * @brief Sets the instruction set the kernels are dispatched to.
+ * @details This is meant for benchmarking and testing. An unsupported instruction set falls back to the fastest
+ * supported one.
+ * @param instruction_set The instruction set to use.
+ */
+void set_instruction_set(const InstructionSet instruction_set) {
+  const InstructionSet supported_instruction_set = get_supported_instruction_set();
+
+  chosen_instruction_set = instruction_set > supported_instruction_set ? supported_instruction_set : instruction_set;
+  is_instruction_set_chosen = true;
+}
+
+/**
+ * @brief Calculates the value of a point in one of the extreme directions, where the extreme point has the highest.
+ * @param x The x-coordinate of the point.
+ * @param y The y-coordinate of the point.
+ * @param direction The direction to use, in the order documented by `find_extreme_points`.
+ * @return The value of the point in the direction.
+ */
+static double extreme_value(const double x, const double y, const size_t direction) {
+  switch (direction) {
+    case 0:
+      return -y;
+    case 1:
+      return x - y;
+    case 2:
+      return x;
+    case 3:
+      return x + y;
+    case 4:
+      return y;
+    case 5:
+      return y - x;
+    case 6:
+      return -x;
+    default:
+      return -(x + y);
+  }
+}
+
+/**
+ * @brief Calculates the orientation of the angle formed by two fixed points and a point of a batch.
+ * @details The vectorized kernels defer to this for the points whose cross products are too close to zero to trust.
+ * @param[in] points The points of the batch.
+ * @param idx The index of the point to use as the third point of the angle.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @return The result of `orientation(a, vertex, point)`.
+ */
+static int point_orientation(const PointSoA* const points, const size_t idx, const Point* const a,
+                             const Point* const vertex) {
+  const Point point = {points->x[idx], points->y[idx]};
+
+  return orientation(a, vertex, &point);
+}
+
+/**
+ * @brief Calculates the orientations of the angles for a range of points one at a time.
+ * @param[in] points The points to use as the third points of the angles.
+ * @param start_idx The index of the first point of the range.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @param[out] orientations The orientations of the angles.
+ */
+static void scalar_batch_orientation(const PointSoA* const points, const size_t start_idx, const Point* const a,
+                                     const Point* const vertex, signed char* const orientations) {
+  for (size_t i = start_idx; i < points->count; i++) {
+    orientations[i] = (signed char)point_orientation(points, i, a, vertex);
+  }
+}
+
+/**
+ * @brief Calculates the bounding box of a range of points one at a time, extending an existing bounding box.
+ * @param[in] points The points to use.
+ * @param start_idx The index of the first point of the range.
+ * @param[in,out] box The bounding box to extend.
+ */
+static void scalar_find_bounding_box(const PointSoA* const points, const size_t start_idx, BoundingBox* const box) {
+  for (size_t i = start_idx; i < points->count; i++) {
+    if (points->x[i] < box->min_x) {
+      box->min_x = points->x[i];
+    }
+
+    if (points->y[i] < box->min_y) {
+      box->min_y = points->y[i];
+    }
+
+    if (points->x[i] > box->max_x) {
+      box->max_x = points->x[i];
+    }
+
+    if (points->y[i] > box->max_y) {
+      box->max_y = points->y[i];
+    }
+  }
+}
+
+/**
+ * @brief Locates the extreme points of a range of points one at a time, continuing from existing extreme points.
+ * @param[in] points The points to search.
+ * @param start_idx The index of the first point of the range.
+ * @param[in,out] extreme_idxs The indexes of the extreme points in each direction.
+ */
+static void scalar_find_extreme_points(const PointSoA* const points, const size_t start_idx,
+                                       size_t extreme_idxs[EXTREME_DIRECTION_COUNT]) {
+  for (size_t i = start_idx; i < points->count; i++) {
+    for (size_t j = 0; j < EXTREME_DIRECTION_COUNT; j++) {
+      const size_t extreme_idx = extreme_idxs[j];
+
+      if (extreme_value(points->x[i], points->y[i], j) >
+          extreme_value(points->x[extreme_idx], points->y[extreme_idx], j)) {
+        extreme_idxs[j] = i;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Checks which points of a range are strictly inside a convex polygon one at a time.
+ * @param[in] points The points to check.
+ * @param start_idx The index of the first point of the range.
+ * @param[in] vertices The vertices of the polygon.
+ * @param vertex_cnt The number of vertices of the polygon.
+ * @param[out] is_inside Whether each point is strictly inside the polygon.
+ */
+static void scalar_find_strictly_inside(const PointSoA* const points, const size_t start_idx,
+                                        const Point* const vertices, const size_t vertex_cnt,
+                                        unsigned char* const is_inside) {
+  for (size_t i = start_idx; i < points->count; i++) {
+    bool is_point_inside = true;
+
+    for (size_t j = 0; j < vertex_cnt && is_point_inside; j++) {
+      is_point_inside = point_orientation(points, i, &vertices[j], &vertices[(j + 1) % vertex_cnt]) > 0;
+    }
+
+    is_inside[i] = is_point_inside;
+  }
+}
+
+#if HAS_X86_KERNELS
+
+/**
+ * @brief Calculates the cross products of the angles formed by two fixed points and two points at a time.
+ * @details The cross products are calculated with the same products as `orientation`, so the lanes it would
+ * recalculate exactly are the ones flagged as uncertain.
+ * @param a_x The x-coordinate of the first point, in every lane.
+ * @param a_y The y-coordinate of the first point, in every lane.
+ * @param vertex_x The x-coordinate of the vertex, in every lane.
+ * @param vertex_y The y-coordinate of the vertex, in every lane.
+ * @param x The x-coordinates of the third points.
+ * @param y The y-coordinates of the third points.
+ * @param[out] uncertain_mask The lanes whose cross products are too close to zero for their signs to be trusted.
+ * @return The cross products of the angles.
+ */
+__attribute__((target("sse2"))) static __m128d sse2_orientation_area(const __m128d a_x, const __m128d a_y,
+                                                                       const __m128d vertex_x, const __m128d vertex_y,
+                                                                       const __m128d x, const __m128d y,
+                                                                       int* const uncertain_mask) {
+  const __m128d sign_mask = _mm_set1_pd(-0.0);
+  const __m128d left_product = _mm_mul_pd(_mm_sub_pd(a_x, x), _mm_sub_pd(vertex_y, y));
+  const __m128d right_product = _mm_mul_pd(_mm_sub_pd(a_y, y), _mm_sub_pd(vertex_x, x));
+  const __m128d magnitude = _mm_add_pd(_mm_andnot_pd(sign_mask, left_product), _mm_andnot_pd(sign_mask, right_product));
+  const __m128d area = _mm_sub_pd(left_product, right_product);
+
+  const __m128d error_bound = _mm_mul_pd(_mm_set1_pd(ORIENTATION_ERROR_BOUND), magnitude);
+
+  *uncertain_mask = _mm_movemask_pd(_mm_cmplt_pd(_mm_andnot_pd(sign_mask, area), error_bound));
+
+  return area;
+}
+
+/**
+ * @brief Calculates the cross products of the angles formed by two fixed points and four points at a time.
+ * @details The cross products are calculated with the same products as `orientation`, so the lanes it would
+ * recalculate exactly are the ones flagged as uncertain.
+ * @param a_x The x-coordinate of the first point, in every lane.
+ * @param a_y The y-coordinate of the first point, in every lane.
+ * @param vertex_x The x-coordinate of the vertex, in every lane.
+ * @param vertex_y The y-coordinate of the vertex, in every lane.
+ * @param x The x-coordinates of the third points.
+ * @param y The y-coordinates of the third points.
+ * @param[out] uncertain_mask The lanes whose cross products are too close to zero for their signs to be trusted.
+ * @return The cross products of the angles.
+ */
+__attribute__((target("avx2"))) static __m256d avx2_orientation_area(const __m256d a_x, const __m256d a_y,
+                                                                       const __m256d vertex_x, const __m256d vertex_y,
+                                                                       const __m256d x, const __m256d y,
+                                                                       int* const uncertain_mask) {
+  const __m256d sign_mask = _mm256_set1_pd(-0.0);
+  const __m256d left_product = _mm256_mul_pd(_mm256_sub_pd(a_x, x), _mm256_sub_pd(vertex_y, y));
+  const __m256d right_product = _mm256_mul_pd(_mm256_sub_pd(a_y, y), _mm256_sub_pd(vertex_x, x));
+  const __m256d magnitude =
+      _mm256_add_pd(_mm256_andnot_pd(sign_mask, left_product), _mm256_andnot_pd(sign_mask, right_product));
+  const __m256d area = _mm256_sub_pd(left_product, right_product);
+
+  const __m256d error_bound = _mm256_mul_pd(_mm256_set1_pd(ORIENTATION_ERROR_BOUND), magnitude);
+
+  *uncertain_mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(sign_mask, area), error_bound, _CMP_LT_OQ));
+
+  return area;
+}
+
+/**
+ * @brief Calculates the orientations of the angles for two points at a time.
+ * @param[in] points The points to use as the third points of the angles.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @param[out] orientations The orientations of the angles.
+ */
+__attribute__((target("sse2"))) static void sse2_batch_orientation(const PointSoA* const points,
+                                                                     const Point* const a, const Point* const vertex,
+                                                                     signed char* const orientations) {
+  const __m128d a_x = _mm_set1_pd(a->x);
+  const __m128d a_y = _mm_set1_pd(a->y);
+  const __m128d vertex_x = _mm_set1_pd(vertex->x);
+  const __m128d vertex_y = _mm_set1_pd(vertex->y);
+  const __m128d zero = _mm_setzero_pd();
+  size_t i = 0;
+
+  for (; i + 2 <= points->count; i += 2) {
+    int uncertain_mask;
+    const __m128d area = sse2_orientation_area(a_x, a_y, vertex_x, vertex_y, _mm_loadu_pd(&points->x[i]),
+                                               _mm_loadu_pd(&points->y[i]), &uncertain_mask);
+    const int positive_mask = _mm_movemask_pd(_mm_cmpgt_pd(area, zero));
+    const int negative_mask = _mm_movemask_pd(_mm_cmplt_pd(area, zero));
+
+    for (int j = 0; j < 2; j++) {
+      orientations[i + j] = (uncertain_mask >> j) & 1
+                                ? (signed char)point_orientation(points, i + (size_t)j, a, vertex)
+                                : (signed char)(((positive_mask >> j) & 1) - ((negative_mask >> j) & 1));
+    }
+  }
+
+  scalar_batch_orientation(points, i, a, vertex, orientations);
+}
+
+/**
+ * @brief Calculates the orientations of the angles for four points at a time.
+ * @param[in] points The points to use as the third points of the angles.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @param[out] orientations The orientations of the angles.
+ */
+__attribute__((target("avx2"))) static void avx2_batch_orientation(const PointSoA* const points,
+                                                                     const Point* const a, const Point* const vertex,
+                                                                     signed char* const orientations) {
+  const __m256d a_x = _mm256_set1_pd(a->x);
+  const __m256d a_y = _mm256_set1_pd(a->y);
+  const __m256d vertex_x = _mm256_set1_pd(vertex->x);
+  const __m256d vertex_y = _mm256_set1_pd(vertex->y);
+  const __m256d zero = _mm256_setzero_pd();
+  size_t i = 0;
+
+  for (; i + 4 <= points->count; i += 4) {
+    int uncertain_mask;
+    const __m256d area = avx2_orientation_area(a_x, a_y, vertex_x, vertex_y, _mm256_loadu_pd(&points->x[i]),
+                                               _mm256_loadu_pd(&points->y[i]), &uncertain_mask);
+    const int positive_mask = _mm256_movemask_pd(_mm256_cmp_pd(area, zero, _CMP_GT_OQ));
+    const int negative_mask = _mm256_movemask_pd(_mm256_cmp_pd(area, zero, _CMP_LT_OQ));
+
+    for (int j = 0; j < 4; j++) {
+      orientations[i + j] = (uncertain_mask >> j) & 1
+                                ? (signed char)point_orientation(points, i + (size_t)j, a, vertex)
+                                : (signed char)(((positive_mask >> j) & 1) - ((negative_mask >> j) & 1));
+    }
+  }
+
+  scalar_batch_orientation(points, i, a, vertex, orientations);
+}
+
+/**
+ * @brief Calculates the bounding box of a batch of points two at a time.
+ * @param[in] points The points to use.
+ * @param[out] box The bounding box of the points.
+ */
+__attribute__((target("sse2"))) static void sse2_find_bounding_box(const PointSoA* const points,
+                                                                     BoundingBox* const box) {
+  __m128d min_x = _mm_set1_pd(points->x[0]);
+  __m128d min_y = _mm_set1_pd(points->y[0]);
+  __m128d max_x = min_x;
+  __m128d max_y = min_y;
+  size_t i = 0;
+
+  for (; i + 2 <= points->count; i += 2) {
+    const __m128d x = _mm_loadu_pd(&points->x[i]);
+    const __m128d y = _mm_loadu_pd(&points->y[i]);
+
+    min_x = _mm_min_pd(min_x, x);
+    min_y = _mm_min_pd(min_y, y);
+    max_x = _mm_max_pd(max_x, x);
+    max_y = _mm_max_pd(max_y, y);
+  }
+
+  double lanes[2];
+
+  _mm_storeu_pd(lanes, _mm_min_pd(min_x, _mm_shuffle_pd(min_x, min_x, 1)));
+  box->min_x = lanes[0];
+  _mm_storeu_pd(lanes, _mm_min_pd(min_y, _mm_shuffle_pd(min_y, min_y, 1)));
+  box->min_y = lanes[0];
+  _mm_storeu_pd(lanes, _mm_max_pd(max_x, _mm_shuffle_pd(max_x, max_x, 1)));
+  box->max_x = lanes[0];
+  _mm_storeu_pd(lanes, _mm_max_pd(max_y, _mm_shuffle_pd(max_y, max_y, 1)));
+  box->max_y = lanes[0];
+
+  scalar_find_bounding_box(points, i, box);
+}
+
+/**
+ * @brief Reduces the four lanes of a vector to their lowest or highest value.
+ * @param values The vector to reduce.
+ * @param is_max Whether to reduce to the highest value instead of the lowest.
+ * @return The lowest or highest value of the lanes.
+ */
+__attribute__((target("avx2"))) static double avx2_reduce(const __m256d values, const bool is_max) {
+  double lanes[4];
+
+  _mm256_storeu_pd(lanes, values);
+
+  double result = lanes[0];
+
+  for (size_t i = 1; i < 4; i++) {
+    if (is_max ? lanes[i] > result : lanes[i] < result) {
+      result = lanes[i];
+    }
+  }
+
+  return result;
+}
+
+/**
+ * @brief Calculates the bounding box of a batch of points four at a time.
+ * @param[in] points The points to use.
+ * @param[out] box The bounding box of the points.
+ */
+__attribute__((target("avx2"))) static void avx2_find_bounding_box(const PointSoA* const points,
+                                                                     BoundingBox* const box) {
+  __m256d min_x = _mm256_set1_pd(points->x[0]);
+  __m256d min_y = _mm256_set1_pd(points->y[0]);
+  __m256d max_x = min_x;
+  __m256d max_y = min_y;
+  size_t i = 0;
+
+  for (; i + 4 <= points->count; i += 4) {
+    const __m256d x = _mm256_loadu_pd(&points->x[i]);
+    const __m256d y = _mm256_loadu_pd(&points->y[i]);
+
+    min_x = _mm256_min_pd(min_x, x);
+    min_y = _mm256_min_pd(min_y, y);
+    max_x = _mm256_max_pd(max_x, x);
+    max_y = _mm256_max_pd(max_y, y);
+  }
+
+  box->min_x = avx2_reduce(min_x, false);
+  box->min_y = avx2_reduce(min_y, false);
+  box->max_x = avx2_reduce(max_x, true);
+  box->max_y = avx2_reduce(max_y, true);
+
+  scalar_find_bounding_box(points, i, box);
+}
+
+/**
+ * @brief Calculates the values of four points at a time in one of the extreme directions.
+ * @param x The x-coordinates of the points.
+ * @param y The y-coordinates of the points.
+ * @param direction The direction to use, in the order documented by `find_extreme_points`.
+ * @return The values of the points in the direction, matching `extreme_value` exactly.
+ */
+__attribute__((target("avx2"))) static __m256d avx2_extreme_value(const __m256d x, const __m256d y,
+                                                                    const size_t direction) {
+  const __m256d zero = _mm256_setzero_pd();
+
+  switch (direction) {
+    case 0:
+      return _mm256_sub_pd(zero, y);
+    case 1:
+      return _mm256_sub_pd(x, y);
+    case 2:
+      return x;
+    case 3:
+      return _mm256_add_pd(x, y);
+    case 4:
+      return y;
+    case 5:
+      return _mm256_sub_pd(y, x);
+    case 6:
+      return _mm256_sub_pd(zero, x);
+    default:
+      return _mm256_sub_pd(zero, _mm256_add_pd(x, y));
+  }
+}
+
+/**
+ * @brief Locates the extreme points of a batch of points four at a time.
+ * @details Every lane tracks the first extreme point among the points it sees. The lanes are then reduced to the
+ * highest value, preferring the lowest index when the values are equal, so the result matches the scalar search.
+ * @param[in] points The points to search.
+ * @param[out] extreme_idxs The indexes of the extreme points in each direction.
+ */
+__attribute__((target("avx2"))) static void avx2_find_extreme_points(const PointSoA* const points,
+                                                                       size_t extreme_idxs[EXTREME_DIRECTION_COUNT]) {
+  const __m256d x = _mm256_loadu_pd(points->x);
+  const __m256d y = _mm256_loadu_pd(points->y);
+  const __m256d idx_step = _mm256_set1_pd(4);
+  __m256d idxs = _mm256_set_pd(3, 2, 1, 0);
+  __m256d extreme_values[EXTREME_DIRECTION_COUNT];
+  __m256d extreme_lane_idxs[EXTREME_DIRECTION_COUNT];
+
+  for (size_t j = 0; j < EXTREME_DIRECTION_COUNT; j++) {
+    extreme_values[j] = avx2_extreme_value(x, y, j);
+    extreme_lane_idxs[j] = idxs;
+  }
+
+  size_t i = 4;
+
+  for (; i + 4 <= points->count; i += 4) {
+    const __m256d next_x = _mm256_loadu_pd(&points->x[i]);
+    const __m256d next_y = _mm256_loadu_pd(&points->y[i]);
+
+    idxs = _mm256_add_pd(idxs, idx_step);
+
+    for (size_t j = 0; j < EXTREME_DIRECTION_COUNT; j++) {
+      const __m256d values = avx2_extreme_value(next_x, next_y, j);
+      const __m256d is_greater = _mm256_cmp_pd(values, extreme_values[j], _CMP_GT_OQ);
+
+      extreme_values[j] = _mm256_blendv_pd(extreme_values[j], values, is_greater);
+      extreme_lane_idxs[j] = _mm256_blendv_pd(extreme_lane_idxs[j], idxs, is_greater);
+    }
+  }
+
+  for (size_t j = 0; j < EXTREME_DIRECTION_COUNT; j++) {
+    double lane_values[4];
+    double lane_idxs[4];
+
+    _mm256_storeu_pd(lane_values, extreme_values[j]);
+    _mm256_storeu_pd(lane_idxs, extreme_lane_idxs[j]);
+
+    size_t best_lane = 0;
+
+    for (size_t k = 1; k < 4; k++) {
+      if (lane_values[k] > lane_values[best_lane] ||
+          (lane_values[k] == lane_values[best_lane] && lane_idxs[k] < lane_idxs[best_lane])) {
+        best_lane = k;
+      }
+    }
+
+    extreme_idxs[j] = (size_t)lane_idxs[best_lane];
+  }
+
+  scalar_find_extreme_points(points, i, extreme_idxs);
+}
+
+/**
+ * @brief Checks which points of a batch are strictly inside a convex polygon two at a time.
+ * @param[in] points The points to check.
+ * @param[in] vertices The vertices of the polygon.
+ * @param vertex_cnt The number of vertices of the polygon.
+ * @param[out] is_inside Whether each point is strictly inside the polygon.
+ */
+__attribute__((target("sse2"))) static void sse2_find_strictly_inside(const PointSoA* const points,
+                                                                        const Point* const vertices,
+                                                                        const size_t vertex_cnt,
+                                                                        unsigned char* const is_inside) {
+  const __m128d zero = _mm_setzero_pd();
+  size_t i = 0;
+
+  for (; i + 2 <= points->count; i += 2) {
+    const __m128d x = _mm_loadu_pd(&points->x[i]);
+    const __m128d y = _mm_loadu_pd(&points->y[i]);
+    int inside_mask = 3;
+
+    for (size_t j = 0; j < vertex_cnt && inside_mask; j++) {
+      const Point* const edge_start = &vertices[j];
+      const Point* const edge_end = &vertices[(j + 1) % vertex_cnt];
+      int uncertain_mask;
+      const __m128d area = sse2_orientation_area(_mm_set1_pd(edge_start->x), _mm_set1_pd(edge_start->y),
+                                                 _mm_set1_pd(edge_end->x), _mm_set1_pd(edge_end->y), x, y,
+                                                 &uncertain_mask);
+      int edge_mask = _mm_movemask_pd(_mm_cmpgt_pd(area, zero)) & ~uncertain_mask;
+
+      for (int k = 0; k < 2; k++) {
+        if ((uncertain_mask & inside_mask & 1 << k) &&
+            point_orientation(points, i + (size_t)k, edge_start, edge_end) > 0) {
+          edge_mask |= 1 << k;
+        }
+      }
+
+      inside_mask &= edge_mask;
+    }
+
+    for (int j = 0; j < 2; j++) {
+      is_inside[i + j] = (unsigned char)((inside_mask >> j) & 1);
+    }
+  }
+
+  scalar_find_strictly_inside(points, i, vertices, vertex_cnt, is_inside);
+}
+
+/**
+ * @brief Checks which points of a batch are strictly inside a convex polygon four at a time.
+ * @param[in] points The points to check.
+ * @param[in] vertices The vertices of the polygon.
+ * @param vertex_cnt The number of vertices of the polygon.
+ * @param[out] is_inside Whether each point is strictly inside the polygon.
+ */
+__attribute__((target("avx2"))) static void avx2_find_strictly_inside(const PointSoA* const points,
+                                                                        const Point* const vertices,
+                                                                        const size_t vertex_cnt,
+                                                                        unsigned char* const is_inside) {
+  const __m256d zero = _mm256_setzero_pd();
+  size_t i = 0;
+
+  for (; i + 4 <= points->count; i += 4) {
+    const __m256d x = _mm256_loadu_pd(&points->x[i]);
+    const __m256d y = _mm256_loadu_pd(&points->y[i]);
+    int inside_mask = 15;
+
+    for (size_t j = 0; j < vertex_cnt && inside_mask; j++) {
+      const Point* const edge_start = &vertices[j];
+      const Point* const edge_end = &vertices[(j + 1) % vertex_cnt];
+      int uncertain_mask;
+      const __m256d area = avx2_orientation_area(_mm256_set1_pd(edge_start->x), _mm256_set1_pd(edge_start->y),
+                                                 _mm256_set1_pd(edge_end->x), _mm256_set1_pd(edge_end->y), x, y,
+                                                 &uncertain_mask);
+      int edge_mask = _mm256_movemask_pd(_mm256_cmp_pd(area, zero, _CMP_GT_OQ)) & ~uncertain_mask;
+
+      for (int k = 0; k < 4; k++) {
+        if ((uncertain_mask & inside_mask & 1 << k) &&
+            point_orientation(points, i + (size_t)k, edge_start, edge_end) > 0) {
+          edge_mask |= 1 << k;
+        }
+      }
+
+      inside_mask &= edge_mask;
+    }
+
+    for (int j = 0; j < 4; j++) {
+      is_inside[i + j] = (unsigned char)((inside_mask >> j) & 1);
+    }
+  }
+
+  scalar_find_strictly_inside(points, i, vertices, vertex_cnt, is_inside);
+}
+
+#endif
+
+/**
+ * @brief Calculates the orientations of the angles formed by two fixed points and each point of a batch.
+ * @details Every orientation is identical to the one calculated by `orientation(a, vertex, point)`. The vectorized
+ * kernels calculate the same products as `orientation`, and the points whose cross products are within its error bound
+ * of zero are handed to it, so nearly collinear points get the exact orientation on every instruction set.
+ * @param[in] points The points to use as the third points of the angles.
+ * @param[in] a The first point to use.
+ * @param[in] vertex The vertex to use.
+ * @param[out] orientations The orientations of the angles, `-1` if clockwise, `1` if counter-clockwise, or `0` if
+ * collinear. This must be able to contain all of the points.
+ */
+void batch_orientation(const PointSoA* const points, const Point* const a, const Point* const vertex,
+                       signed char* const orientations) {
+#if HAS_X86_KERNELS
+  switch (get_instruction_set()) {
+    case AVX2_INSTRUCTION_SET:
+      avx2_batch_orientation(points, a, vertex, orientations);
+      return;
+    case SSE2_INSTRUCTION_SET:
+      sse2_batch_orientation(points, a, vertex, orientations);
+      return;
+    default:
+      break;
+  }
+#endif
+
+  scalar_batch_orientation(points, 0, a, vertex, orientations);
+}
+
+/**
+ * @brief Calculates the bounding box of a batch of points.
+ * @param[in] points The points to use.
+ * @param[out] box The bounding box of the points.
+ * @pre The batch contains at least one point.
+ */
+void find_bounding_box(const PointSoA* const points, BoundingBox* const box) {
+#if HAS_X86_KERNELS
+  switch (get_instruction_set()) {
+    case AVX2_INSTRUCTION_SET:
+      avx2_find_bounding_box(points, box);
+      return;
+    case SSE2_INSTRUCTION_SET:
+      sse2_find_bounding_box(points, box);
+      return;
+    default:
+      break;
+  }
+#endif
+
+  box->min_x = box->max_x = points->x[0];
+  box->min_y = box->max_y = points->y[0];
+
+  scalar_find_bounding_box(points, 1, box);
+}
+
+/**
+ * @brief Locates the extreme points of a batch of points in eight directions.
+ * @details The directions are in counter-clockwise order, starting from the bottom: the lowest y-coordinate, the
+ * highest `x - y`, the highest x-coordinate, the highest `x + y`, the highest y-coordinate, the highest `y - x`, the
+ * lowest x-coordinate, and the lowest `x + y`. If multiple points are extreme in a direction, the first is used.
+ * @param[in] points The points to search.
+ * @param[out] extreme_indexes The indexes of the extreme points in each direction.
+ * @pre The batch contains at least one point.
+ */
+void find_extreme_points(const PointSoA* const points, size_t extreme_indexes[EXTREME_DIRECTION_COUNT]) {
+#if HAS_X86_KERNELS
+  // SSE2 has no blend, and two lanes barely outrun the scalar search, so only AVX2 is vectorized
+  if (get_instruction_set() == AVX2_INSTRUCTION_SET && points->count >= 4) {
+    avx2_find_extreme_points(points, extreme_indexes);
+
+    return;
+  }
+#endif
+
+  for (size_t j = 0; j < EXTREME_DIRECTION_COUNT; j++) {
+    extreme_indexes[j] = 0;
+  }
+
+  scalar_find_extreme_points(points, 1, extreme_indexes);
+}
+
+/**
+ * @brief Checks which points of a batch are strictly inside a convex polygon.
+ * @details The polygon's vertices must be in counter-clockwise order without repeated vertices. A point is strictly
+ * inside if `orientation(start, end, point)` is positive for every edge of the polygon. Like `batch_orientation`, the
+ * points whose cross products are within `orientation`'s error bound of zero are handed to it, so the result is the
+ * same on every instruction set.
+ * @param[in] points The points to check.
+ * @param[in] vertices The vertices of the polygon.
+ * @param vertex_cnt The number of vertices of the polygon.
+ * @param[out] is_inside Whether each point is strictly inside the polygon. This must be able to contain all of the
+ * points.
+ */
+void find_strictly_inside(const PointSoA* const points, const Point* const vertices, const size_t vertex_cnt,
+                          unsigned char* const is_inside) {
+#if HAS_X86_KERNELS
+  switch (get_instruction_set()) {
+    case AVX2_INSTRUCTION_SET:
+      avx2_find_strictly_inside(points, vertices, vertex_cnt, is_inside);
+      return;
+    case SSE2_INSTRUCTION_SET:
+      sse2_find_strictly_inside(points, vertices, vertex_cnt, is_inside);
+      return;
+    default:
+      break;
+  }
+#endif
+
+  scalar_find_strictly_inside(points, 0, vertices, vertex_cnt, is_inside);
+}
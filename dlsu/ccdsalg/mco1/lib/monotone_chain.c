@@ -0,0 +1,186 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/monotone_chain.h"
+
+#include "convex_hull/sort.h"
+#include "convex_hull/stack.h"
+
+/**
+ * @brief Reverses the order of a range of points.
+ * @param[in,out] points The points to reverse.
+ * @param point_cnt The number of points to reverse.
+ */
+static void reverse(Point* const points, const size_t point_cnt) {
+  for (size_t i = 0; i < point_cnt / 2; i++) {
+    swap(&points[i], &points[point_cnt - 1 - i]);
+  }
+}
+
+/**
+ * @brief Scans points already sorted by their x-coordinates, and y-coordinates if multiple, to find the points that
+ * would make up the convex hull into a caller-owned array using Andrew's monotone chain algorithm.
+ * @details This is `monotone_chain_scan_into` without the sorting, so the phases can be timed separately. The lower
+ * and the upper halves of the convex hull are built by checking the points below and above the line between the
+ * leftmost and the rightmost points one-by-one, from left to right and then from right to left, for the direction of
+ * the angle they form. This never allocates.
+ * @param[in] points The sorted points to scan.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_cnt The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_cnt` always fits.
+ */
+bool monotone_chain_scan_sorted_into(const Point* const points, const size_t point_cnt, Point* const convex_points,
+                                     const size_t convex_point_capacity, size_t* const convex_point_cnt) {
+  Stack stack;
+
+  create(&stack, convex_points, convex_point_capacity);
+
+  if (point_cnt == 0) {
+    *convex_point_cnt = 0;
+
+    return true;
+  }
+
+  const Point* const leftmost_point = &points[0];
+  const Point* const rightmost_point = &points[point_cnt - 1];
+
+  // duplicates of a single point would otherwise be kept as both of the halves' ends
+  if (leftmost_point->x == rightmost_point->x && leftmost_point->y == rightmost_point->y) {
+    if (convex_point_capacity < 1) {
+      return false;
+    }
+
+    convex_points[0] = *leftmost_point;
+    *convex_point_cnt = 1;
+
+    return true;
+  }
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    const Point* const next_point = &points[i];
+
+    // points above the line between the leftmost and the rightmost points can only be on the upper half
+    if (orientation(leftmost_point, rightmost_point, next_point) > 0) {
+      continue;
+    }
+
+    while (!is_empty(&stack) && stack.top > 0 && orientation(next_to_top(&stack), top(&stack), next_point) <= 0) {
+      pop(&stack);
+    }
+
+    if (is_full(&stack)) {
+      return false;
+    }
+
+    push(&stack, *next_point);
+  }
+
+  const size_t lower_hull_top = stack.top;
+
+  for (size_t i = point_cnt - 1; i > 0; i--) {
+    const Point* const next_point = &points[i - 1];
+
+    if (i > 1 && orientation(leftmost_point, rightmost_point, next_point) <= 0) {
+      continue;
+    }
+
+    while (stack.top > lower_hull_top && orientation(next_to_top(&stack), top(&stack), next_point) <= 0) {
+      pop(&stack);
+    }
+
+    // the upper half ends on the leftmost point, which already starts the lower half
+    if (i == 1) {
+      break;
+    }
+
+    if (is_full(&stack)) {
+      return false;
+    }
+
+    push(&stack, *next_point);
+  }
+
+  const size_t hull_cnt = stack.top + 1;
+  size_t anchor_point_idx = 0;
+
+  for (size_t i = 1; i < hull_cnt; i++) {
+    const Point* const anchor_point = &convex_points[anchor_point_idx];
+    const Point* const pt = &convex_points[i];
+
+    if (pt->y < anchor_point->y || (pt->y == anchor_point->y && pt->x < anchor_point->x)) {
+      anchor_point_idx = i;
+    }
+  }
+
+  reverse(convex_points, anchor_point_idx);
+  reverse(&convex_points[anchor_point_idx], hull_cnt - anchor_point_idx);
+  reverse(convex_points, hull_cnt);
+
+  *convex_point_cnt = hull_cnt;
+
+  return true;
+}
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull into a caller-owned array using Andrew's
+ * monotone chain algorithm.
+ * @details This sorts the points by their x-coordinates, and y-coordinates if multiple, using the heap sort algorithm.
+ * Then, the lower and the upper halves of the convex hull are built by checking the points below and above the line
+ * between the leftmost and the rightmost points one-by-one, from left to right and then from right to left, for the
+ * direction of the angle they form. Only the orientation of the points is
+ * ever compared, so the sorting never calculates polar angles or distances. The convex hull is rotated to start from
+ * the point with the lowest y-coordinate, and lowest x-coordinate if multiple, to match the order of the Graham scans.
+ * This never allocates. The array doubles as the scan's stack, so it must fit every point the scan has yet to reject.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param convex_point_capacity The number of points the array can contain.
+ * @param[out] convex_point_cnt The number of points from the created convex set.
+ * @return Whether the convex set fit into the array. A capacity of `point_cnt` always fits.
+ */
+bool monotone_chain_scan_into(Point* const points, const size_t point_cnt, Point* const convex_points,
+                              const size_t convex_point_capacity, size_t* const convex_point_cnt) {
+  lexicographic_sort(points, point_cnt);
+
+  return monotone_chain_scan_sorted_into(points, point_cnt, convex_points, convex_point_capacity, convex_point_cnt);
+}
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull using Andrew's monotone chain algorithm.
+ * @details This sorts the points by their x-coordinates, and y-coordinates if multiple, using the heap sort algorithm.
+ * Then, the lower and the upper halves of the convex hull are built by checking the points below and above the line
+ * between the leftmost and the rightmost points one-by-one, from left to right and then from right to left, for the
+ * direction of the angle they form. Only the orientation of the points is
+ * ever compared, so the sorting never calculates polar angles or distances. The convex hull is rotated to start from
+ * the point with the lowest y-coordinate, and lowest x-coordinate if multiple, to match the order of the Graham scans.
+ * The convex set's buffer is only grown when it can't contain all of the points, so reusing the same buffer across
+ * scans stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param[out] convex_points The points from the created convex set.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool monotone_chain_scan(PointBuffer* const points, PointBuffer* const convex_points) {
+  if (!reserve_points(convex_points, points->count)) {
+    return false;
+  }
+
+  return monotone_chain_scan_into(points->elements, points->count, convex_points->elements, convex_points->capacity,
+                                  &convex_points->count);
+}
@@ -0,0 +1,170 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "convex_hull/parallel_scan.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "convex_hull/graham_scan2.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+/** @brief A chunk of points to be scanned by a thread. */
+typedef struct ScanTask {
+  /** @brief The points of the chunk. */
+  Point* points;
+  /** @brief The number of points of the chunk. */
+  size_t point_count;
+  /** @brief The scan to find the chunk's convex hull with. */
+  InPlaceScan scan;
+  /** @brief The number of points from the chunk's convex set at the front of the chunk. */
+  size_t convex_point_count;
+  /** @brief The thread scanning the chunk. */
+  pthread_t thread;
+  /** @brief Whether the chunk is scanned by its own thread, instead of the calling thread. */
+  bool is_threaded;
+} ScanTask;
+
+/**
+ * @brief Gets the number of processors available to run threads on.
+ * @return The number of online processors, or `1` if it can't be determined.
+ */
+size_t get_processor_count(void) {
+#ifndef _WIN32
+  const long processor_cnt = sysconf(_SC_NPROCESSORS_ONLN);
+
+  if (processor_cnt > 0) {
+    return (size_t)processor_cnt;
+  }
+#endif
+
+  return 1;
+}
+
+/**
+ * @brief Scans the points within a scan task's chunk.
+ * @details This is the entry point of the scanning threads.
+ * @param[in,out] task The scan task to run.
+ * @return Always `NULL`.
+ */
+static void* run_scan_task(void* const task) {
+  ScanTask* const scan_task = task;
+
+  scan_task->convex_point_count = scan_task->scan(scan_task->points, scan_task->point_count);
+
+  return NULL;
+}
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using multiple threads.
+ * @details The points are split into contiguous chunks, one per thread, and each thread finds its chunk's convex hull
+ * in place with the scan. Every point of the convex hull is also a point of its chunk's convex hull, so the partial
+ * convex hulls are moved to the front of the array and scanned once more to merge them. Small inputs are given fewer
+ * threads, so no thread scans fewer than `MIN_PARALLEL_CHUNK_SIZE` points. If a thread can't be created, its chunk is
+ * scanned by the calling thread instead.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @param thread_cnt The maximum number of threads to scan with.
+ * @param scan The scan to find each convex hull with.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t parallel_scan_in_place(Point* const points, const size_t point_cnt, const size_t thread_cnt,
+                              const InPlaceScan scan) {
+  const size_t max_chunk_cnt = point_cnt / MIN_PARALLEL_CHUNK_SIZE;
+  const size_t chunk_cnt = thread_cnt < max_chunk_cnt ? thread_cnt : max_chunk_cnt;
+
+  if (chunk_cnt < 2) {
+    return scan(points, point_cnt);
+  }
+
+  ScanTask* const tasks = malloc(chunk_cnt * sizeof(ScanTask));
+
+  if (!tasks) {
+    return scan(points, point_cnt);
+  }
+
+  const size_t chunk_size = point_cnt / chunk_cnt;
+
+  for (size_t i = 0; i < chunk_cnt; i++) {
+    ScanTask* const task = &tasks[i];
+
+    task->points = &points[i * chunk_size];
+    task->point_count = i + 1 < chunk_cnt ? chunk_size : point_cnt - i * chunk_size;
+    task->scan = scan;
+    task->convex_point_count = 0;
+    task->is_threaded = pthread_create(&task->thread, NULL, run_scan_task, task) == 0;
+
+    if (!task->is_threaded) {
+      run_scan_task(task);
+    }
+  }
+
+  for (size_t i = 0; i < chunk_cnt; i++) {
+    if (tasks[i].is_threaded) {
+      pthread_join(tasks[i].thread, NULL);
+    }
+  }
+
+  size_t merged_point_cnt = 0;
+
+  for (size_t i = 0; i < chunk_cnt; i++) {
+    const ScanTask* const task = &tasks[i];
+
+    // every chunk starts at or after the merged points, so moving them forward never overwrites a later chunk
+    memmove(&points[merged_point_cnt], task->points, task->convex_point_count * sizeof(Point));
+
+    merged_point_cnt += task->convex_point_count;
+  }
+
+  free(tasks);
+
+  return scan(points, merged_point_cnt);
+}
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull using multiple threads.
+ * @details This finds the convex hull with `parallel_scan_in_place` and the faster Graham scan, then copies it into the
+ * convex set's buffer. The convex set's buffer is only grown when it can't contain the convex hull, so reusing the same
+ * buffer across scans stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param[out] convex_points The points from the created convex set.
+ * @param thread_cnt The maximum number of threads to scan with.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool parallel_scan(PointBuffer* const points, PointBuffer* const convex_points, const size_t thread_cnt) {
+  const size_t convex_point_cnt = parallel_scan_in_place(points->elements, points->count, thread_cnt,
+                                                         fast_scan_in_place);
+
+  if (!reserve_points(convex_points, convex_point_cnt)) {
+    return false;
+  }
+
+  if (convex_point_cnt > 0) {
+    memcpy(convex_points->elements, points->elements, convex_point_cnt * sizeof(Point));
+  }
+
+  convex_points->count = convex_point_cnt;
+
+  return true;
+}
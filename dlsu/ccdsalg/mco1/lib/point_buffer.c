@@ -0,0 +1,106 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/point_buffer.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief Initializes a point buffer's elements, count, and capacity to their default values.
+ * @details This doesn't allocate. The buffer's elements are set to `NULL`, and its count and capacity to zero.
+ * @relates PointBuffer
+ * @param[in,out] buffer The point buffer to initialize.
+ */
+void create_point_buffer(PointBuffer* const buffer) {
+  buffer->elements = NULL;
+  buffer->count = 0;
+  buffer->capacity = 0;
+}
+
+/**
+ * @brief Ensures that a point buffer can contain a number of points without growing.
+ * @details This reallocates at most once. The new capacity is the larger of the requested capacity and double the
+ * current capacity.
+ * @relates PointBuffer
+ * @param[in,out] buffer The point buffer to grow.
+ * @param capacity The number of points the buffer should be able to contain.
+ * @return Whether the point buffer can contain the number of points.
+ */
+bool reserve_points(PointBuffer* const buffer, const size_t capacity) {
+  if (capacity <= buffer->capacity) {
+    return true;
+  }
+
+  const size_t max_capacity = SIZE_MAX / sizeof(Point);
+
+  if (capacity > max_capacity) {
+    return false;
+  }
+
+  size_t new_capacity = buffer->capacity > max_capacity / 2 ? max_capacity : buffer->capacity * 2;
+
+  if (new_capacity < MIN_POINT_BUFFER_CAPACITY) {
+    new_capacity = MIN_POINT_BUFFER_CAPACITY;
+  }
+
+  if (new_capacity < capacity) {
+    new_capacity = capacity;
+  }
+
+  Point* const new_elements = realloc(buffer->elements, new_capacity * sizeof(Point));
+
+  if (!new_elements) {
+    return false;
+  }
+
+  buffer->elements = new_elements;
+  buffer->capacity = new_capacity;
+
+  return true;
+}
+
+/**
+ * @brief Adds a point to the end of a point buffer.
+ * @details This grows the buffer if it is full.
+ * @relates PointBuffer
+ * @param[in,out] buffer The point buffer to add to.
+ * @param point The point to add.
+ * @return Whether the point was added.
+ */
+bool append_point(PointBuffer* const buffer, const Point point) {
+  if (buffer->count == buffer->capacity && !reserve_points(buffer, buffer->count + 1)) {
+    return false;
+  }
+
+  buffer->elements[buffer->count++] = point;
+
+  return true;
+}
+
+/**
+ * @brief Frees the points of a point buffer.
+ * @details This resets the buffer to its default values, so it can be reused.
+ * @relates PointBuffer
+ * @param[in,out] buffer The point buffer to free.
+ */
+void destroy_point_buffer(PointBuffer* const buffer) {
+  free(buffer->elements);
+
+  create_point_buffer(buffer);
+}
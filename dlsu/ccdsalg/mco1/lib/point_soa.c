@@ -0,0 +1,120 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/point_soa.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief Initializes a structure of arrays' coordinates, count, and capacity to their default values.
+ * @details This doesn't allocate. The coordinate arrays are set to `NULL`, and the count and capacity to zero.
+ * @relates PointSoA
+ * @param[in,out] points The structure of arrays to initialize.
+ */
+void create_point_soa(PointSoA* const points) {
+  points->x = NULL;
+  points->y = NULL;
+  points->count = 0;
+  points->capacity = 0;
+}
+
+/**
+ * @brief Ensures that a structure of arrays can contain a number of points without growing.
+ * @relates PointSoA
+ * @param[in,out] points The structure of arrays to grow.
+ * @param capacity The number of points the structure of arrays should be able to contain.
+ * @return Whether the structure of arrays can contain the number of points.
+ */
+bool reserve_point_soa(PointSoA* const points, const size_t capacity) {
+  if (capacity <= points->capacity) {
+    return true;
+  }
+
+  if (capacity > SIZE_MAX / sizeof(double)) {
+    return false;
+  }
+
+  double* const new_x = realloc(points->x, capacity * sizeof(double));
+
+  if (!new_x) {
+    return false;
+  }
+
+  points->x = new_x;
+
+  double* const new_y = realloc(points->y, capacity * sizeof(double));
+
+  if (!new_y) {
+    return false;
+  }
+
+  points->y = new_y;
+  points->capacity = capacity;
+
+  return true;
+}
+
+/**
+ * @brief Replaces the contents of a structure of arrays with an array of points.
+ * @relates PointSoA
+ * @param[in,out] soa_points The structure of arrays to copy to.
+ * @param[in] points The points to copy from.
+ * @param point_cnt The number of points to copy.
+ * @return Whether the structure of arrays could be grown to contain the points.
+ */
+bool copy_points_to_soa(PointSoA* const soa_points, const Point* const points, const size_t point_cnt) {
+  if (!reserve_point_soa(soa_points, point_cnt)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    soa_points->x[i] = points[i].x;
+    soa_points->y[i] = points[i].y;
+  }
+
+  soa_points->count = point_cnt;
+
+  return true;
+}
+
+/**
+ * @brief Copies the contents of a structure of arrays into an array of points.
+ * @relates PointSoA
+ * @param[in] soa_points The structure of arrays to copy from.
+ * @param[out] points The array to copy to. This must be able to contain all of the points.
+ */
+void copy_points_from_soa(const PointSoA* const soa_points, Point* const points) {
+  for (size_t i = 0; i < soa_points->count; i++) {
+    points[i].x = soa_points->x[i];
+    points[i].y = soa_points->y[i];
+  }
+}
+
+/**
+ * @brief Frees the coordinates of a structure of arrays.
+ * @details This resets the structure of arrays to its default values, so it can be reused.
+ * @relates PointSoA
+ * @param[in,out] points The structure of arrays to free.
+ */
+void destroy_point_soa(PointSoA* const points) {
+  free(points->x);
+  free(points->y);
+
+  create_point_soa(points);
+}
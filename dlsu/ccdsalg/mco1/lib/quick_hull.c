@@ -0,0 +1,378 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/quick_hull.h"
+
+#include <pthread.h>
+#include <string.h>
+
+#include "convex_hull/graham_scan.h"
+
+/** @brief The points on one side of a line, to find the part of the convex hull on that side. */
+typedef struct QuickHullTask {
+  /** @brief The points strictly on the right of the line. */
+  Point* points;
+  /** @brief The number of points on the right of the line. */
+  size_t point_count;
+  /** @brief The start of the line, which is part of the convex hull. */
+  Point start_point;
+  /** @brief The end of the line, which is part of the convex hull. */
+  Point end_point;
+  /** @brief The maximum number of threads to solve the subproblem with. */
+  size_t thread_count;
+  /** @brief The number of points from the subproblem's convex set at the front of its points. */
+  size_t convex_point_count;
+  /** @brief The thread solving the subproblem. */
+  pthread_t thread;
+  /** @brief Whether the subproblem is solved by its own thread, instead of the calling thread. */
+  bool is_threaded;
+} QuickHullTask;
+
+/**
+ * @brief Swaps the values of two points.
+ * @param[in,out] a The point to swap.
+ * @param[in,out] b The point to swap with.
+ */
+static void swap(Point* const a, Point* const b) {
+  const Point temp = *a;
+
+  *a = *b;
+  *b = temp;
+}
+
+/**
+ * @brief Reverses the order of a range of points.
+ * @param[in,out] points The points to reverse.
+ * @param point_cnt The number of points to reverse.
+ */
+static void reverse(Point* const points, const size_t point_cnt) {
+  for (size_t i = 0; i < point_cnt / 2; i++) {
+    swap(&points[i], &points[point_cnt - 1 - i]);
+  }
+}
+
+/**
+ * @brief Moves the points strictly on the right of a line to the front of a range of points.
+ * @param[in,out] points The points to partition.
+ * @param point_cnt The number of points to partition.
+ * @param[in] start_point The start of the line.
+ * @param[in] end_point The end of the line.
+ * @return The number of points on the right of the line at the front of the range.
+ */
+static size_t partition_right(Point* const points, const size_t point_cnt, const Point* const start_point,
+                              const Point* const end_point) {
+  size_t right_point_cnt = 0;
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    if (orientation(start_point, end_point, &points[i]) < 0) {
+      swap(&points[right_point_cnt++], &points[i]);
+    }
+  }
+
+  return right_point_cnt;
+}
+
+/**
+ * @brief Checks if a point is farther along a line than another point the same distance from it.
+ * @details Both points are on the same parallel to the line, so their difference is a multiple of the line's
+ * direction, and comparing a coordinate the line changes along is exact.
+ * @param[in] start_point The start of the line.
+ * @param[in] end_point The end of the line.
+ * @param[in] candidate_point The point to check.
+ * @param[in] farthest_point The point to check against.
+ * @return Whether the candidate point is farther along the line.
+ */
+static bool is_farther_along(const Point* const start_point, const Point* const end_point,
+                             const Point* const candidate_point, const Point* const farthest_point) {
+  if (start_point->x != end_point->x) {
+    return candidate_point->x != farthest_point->x &&
+           (candidate_point->x > farthest_point->x) == (end_point->x > start_point->x);
+  }
+
+  return candidate_point->y != farthest_point->y &&
+         (candidate_point->y > farthest_point->y) == (end_point->y > start_point->y);
+}
+
+/**
+ * @brief Locates the point farthest from a line among points on its right.
+ * @details The distances are compared with `compare_areas`, which is exact, so the farthest point is always part of
+ * the convex hull, even among nearly collinear points whose rounded cross products would tie or swap. If multiple
+ * points are the farthest, the one farthest along the line is located, so it is never between two other points of the
+ * convex hull.
+ * @param[in] points The points to search.
+ * @param point_cnt The number of points to search. This must be at least one.
+ * @param[in] start_point The start of the line.
+ * @param[in] end_point The end of the line.
+ * @return The index of the farthest point.
+ */
+static size_t find_farthest_point(const Point* const points, const size_t point_cnt, const Point* const start_point,
+                                  const Point* const end_point) {
+  size_t farthest_point_idx = 0;
+
+  for (size_t i = 1; i < point_cnt; i++) {
+    const Point* const farthest_point = &points[farthest_point_idx];
+    const int area_order = compare_areas(start_point, end_point, &points[i], farthest_point);
+
+    // the right side has negative cross products, so the farthest point has the least
+    if (area_order < 0 || (area_order == 0 && is_farther_along(start_point, end_point, &points[i], farthest_point))) {
+      farthest_point_idx = i;
+    }
+  }
+
+  return farthest_point_idx;
+}
+
+/**
+ * @brief Initializes a QuickHull subproblem.
+ * @param[out] task The subproblem to initialize.
+ * @param[in] points The points strictly on the right of the line.
+ * @param point_cnt The number of points on the right of the line.
+ * @param[in] start_point The start of the line.
+ * @param[in] end_point The end of the line.
+ */
+static void create_quick_hull_task(QuickHullTask* const task, Point* const points, const size_t point_cnt,
+                                   const Point* const start_point, const Point* const end_point) {
+  task->points = points;
+  task->point_count = point_cnt;
+  task->start_point = *start_point;
+  task->end_point = *end_point;
+  task->thread_count = 1;
+  task->convex_point_count = 0;
+  task->is_threaded = false;
+}
+
+static void solve_quick_hull_tasks(QuickHullTask* const first_task, QuickHullTask* const second_task,
+                                   size_t thread_cnt);
+
+/**
+ * @brief Finds the part of the convex hull on the right of a line.
+ * @details The points are partitioned in place as `[right of start to farthest][farthest][right of farthest to end]`,
+ * and both subproblems are solved recursively, the first on its own thread if it is large enough. Their convex sets
+ * are then moved next to each other with the farthest point between them.
+ * @param[in,out] task The subproblem to solve.
+ */
+static void solve_quick_hull_task(QuickHullTask* const task) {
+  Point* const points = task->points;
+  const size_t point_cnt = task->point_count;
+
+  if (point_cnt == 0) {
+    task->convex_point_count = 0;
+
+    return;
+  }
+
+  const size_t farthest_point_idx = find_farthest_point(points, point_cnt, &task->start_point, &task->end_point);
+  const Point farthest_point = points[farthest_point_idx];
+  const size_t start_point_cnt = partition_right(points, point_cnt, &task->start_point, &farthest_point);
+
+  // the farthest point is never on the right of a line through itself, so it is still among the rest
+  for (size_t i = start_point_cnt; i < point_cnt; i++) {
+    if (points[i].x == farthest_point.x && points[i].y == farthest_point.y) {
+      swap(&points[start_point_cnt], &points[i]);
+
+      break;
+    }
+  }
+
+  Point* const end_points = &points[start_point_cnt + 1];
+  const size_t end_point_cnt = partition_right(end_points, point_cnt - start_point_cnt - 1, &farthest_point,
+                                               &task->end_point);
+  QuickHullTask start_task;
+  QuickHullTask end_task;
+
+  create_quick_hull_task(&start_task, points, start_point_cnt, &task->start_point, &farthest_point);
+  create_quick_hull_task(&end_task, end_points, end_point_cnt, &farthest_point, &task->end_point);
+  solve_quick_hull_tasks(&start_task, &end_task, task->thread_count);
+
+  const size_t start_convex_point_cnt = start_task.convex_point_count;
+
+  points[start_convex_point_cnt] = farthest_point;
+
+  memmove(&points[start_convex_point_cnt + 1], end_points, end_task.convex_point_count * sizeof(Point));
+
+  task->convex_point_count = start_convex_point_cnt + 1 + end_task.convex_point_count;
+}
+
+/**
+ * @brief Solves a QuickHull subproblem.
+ * @details This is the entry point of the QuickHull threads.
+ * @param[in,out] task The subproblem to solve.
+ * @return Always `NULL`.
+ */
+static void* run_quick_hull_task(void* const task) {
+  solve_quick_hull_task(task);
+
+  return NULL;
+}
+
+/**
+ * @brief Solves two independent QuickHull subproblems.
+ * @details If threads remain and the first subproblem is large enough, it is solved by its own thread with half of
+ * the threads, while the calling thread solves the second with the other half. Otherwise, both are solved by the
+ * calling thread one after the other.
+ * @param[in,out] first_task The subproblem that may be given its own thread.
+ * @param[in,out] second_task The subproblem solved by the calling thread.
+ * @param thread_cnt The maximum number of threads to solve both subproblems with.
+ */
+static void solve_quick_hull_tasks(QuickHullTask* const first_task, QuickHullTask* const second_task,
+                                   const size_t thread_cnt) {
+  first_task->thread_count = thread_cnt / 2;
+  first_task->is_threaded = first_task->thread_count > 0 && first_task->point_count >= MIN_QUICK_HULL_TASK_SIZE &&
+                            pthread_create(&first_task->thread, NULL, run_quick_hull_task, first_task) == 0;
+
+  if (first_task->is_threaded) {
+    second_task->thread_count = thread_cnt - first_task->thread_count;
+  } else {
+    first_task->thread_count = thread_cnt;
+    second_task->thread_count = thread_cnt;
+
+    solve_quick_hull_task(first_task);
+  }
+
+  solve_quick_hull_task(second_task);
+
+  if (first_task->is_threaded) {
+    pthread_join(first_task->thread, NULL);
+  }
+}
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using the QuickHull algorithm.
+ * @details This is `parallel_quick_hull_in_place` with a single thread, which follows the `InPlaceScan` signature.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t quick_hull_in_place(Point* const points, const size_t point_cnt) {
+  return parallel_quick_hull_in_place(points, point_cnt, 1);
+}
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull in place using the QuickHull algorithm
+ * and multiple threads.
+ * @details This locates the points with the lowest and highest x-coordinates, and y-coordinates if multiple, which
+ * split the points into those below and above the line between them. On each side, the point farthest from the line
+ * is part of the convex hull, and the points inside the triangle it forms with the line are discarded. The points
+ * outside of the triangle's two other sides are then partitioned in place into two subproblems, which are solved
+ * recursively. Subproblems of at least `MIN_QUICK_HULL_TASK_SIZE` points are given their own thread while threads
+ * remain. If a thread can't be created, its subproblem is solved by the calling thread instead. The points are in the
+ * same order as the Graham scans. This never allocates.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @param thread_cnt The maximum number of threads to scan with.
+ * @return The number of points from the created convex set at the front of the array.
+ */
+size_t parallel_quick_hull_in_place(Point* const points, const size_t point_cnt, const size_t thread_cnt) {
+  if (point_cnt < 3) {
+    return scan_degenerate_points_in_place(points, point_cnt);
+  }
+
+  size_t left_point_idx = 0;
+  size_t right_point_idx = 0;
+
+  for (size_t i = 1; i < point_cnt; i++) {
+    const Point* const pt = &points[i];
+    const Point* const left_point = &points[left_point_idx];
+    const Point* const right_point = &points[right_point_idx];
+
+    if (pt->x < left_point->x || (pt->x == left_point->x && pt->y < left_point->y)) {
+      left_point_idx = i;
+    }
+
+    if (pt->x > right_point->x || (pt->x == right_point->x && pt->y > right_point->y)) {
+      right_point_idx = i;
+    }
+  }
+
+  const Point left_point = points[left_point_idx];
+  const Point right_point = points[right_point_idx];
+
+  if (left_point_idx == right_point_idx || (left_point.x == right_point.x && left_point.y == right_point.y)) {
+    points[0] = left_point;
+
+    return 1;
+  }
+
+  // the lower side is on the right of the line from the leftmost point, and the upper side of the reversed line
+  const size_t lower_point_cnt = partition_right(points, point_cnt, &left_point, &right_point);
+  Point* const upper_points = &points[lower_point_cnt];
+  const size_t upper_point_cnt = partition_right(upper_points, point_cnt - lower_point_cnt, &right_point,
+                                                 &left_point);
+  QuickHullTask lower_task;
+  QuickHullTask upper_task;
+
+  create_quick_hull_task(&lower_task, points, lower_point_cnt, &left_point, &right_point);
+  create_quick_hull_task(&upper_task, upper_points, upper_point_cnt, &right_point, &left_point);
+  solve_quick_hull_tasks(&lower_task, &upper_task, thread_cnt);
+
+  // the convex set is arranged as [leftmost][lower side][rightmost][upper side], which is counter-clockwise
+  const size_t lower_convex_point_cnt = lower_task.convex_point_count;
+  const size_t upper_convex_point_cnt = upper_task.convex_point_count;
+  const size_t convex_point_cnt = lower_convex_point_cnt + upper_convex_point_cnt + 2;
+
+  memmove(&points[lower_convex_point_cnt + 2], upper_points, upper_convex_point_cnt * sizeof(Point));
+  memmove(&points[1], points, lower_convex_point_cnt * sizeof(Point));
+
+  points[0] = left_point;
+  points[lower_convex_point_cnt + 1] = right_point;
+
+  // the anchor point is on the lower side, and rotating the points makes it the first like in the Graham scans
+  size_t anchor_point_idx = 0;
+
+  for (size_t i = 1; i < lower_convex_point_cnt + 2; i++) {
+    const Point* const anchor_point = &points[anchor_point_idx];
+    const Point* const pt = &points[i];
+
+    if (pt->y < anchor_point->y || (pt->y == anchor_point->y && pt->x < anchor_point->x)) {
+      anchor_point_idx = i;
+    }
+  }
+
+  reverse(points, anchor_point_idx);
+  reverse(&points[anchor_point_idx], convex_point_cnt - anchor_point_idx);
+  reverse(points, convex_point_cnt);
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Scans points to find the points that would make up the convex hull using the QuickHull algorithm and
+ * multiple threads.
+ * @details This finds the convex hull with `parallel_quick_hull_in_place`, then copies it into the convex set's buffer.
+ * The convex set's buffer is only grown when it can't contain the convex hull, so reusing the same buffer across scans
+ * stops allocating once it is large enough.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param[out] convex_points The points from the created convex set.
+ * @param thread_cnt The maximum number of threads to scan with.
+ * @return Whether the convex set's buffer could be grown.
+ */
+bool quick_hull(PointBuffer* const points, PointBuffer* const convex_points, const size_t thread_cnt) {
+  const size_t convex_point_cnt = parallel_quick_hull_in_place(points->elements, points->count, thread_cnt);
+
+  if (!reserve_points(convex_points, convex_point_cnt)) {
+    return false;
+  }
+
+  if (convex_point_cnt > 0) {
+    memcpy(convex_points->elements, points->elements, convex_point_cnt * sizeof(Point));
+  }
+
+  convex_points->count = convex_point_cnt;
+
+  return true;
+}
@@ -0,0 +1,352 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/rotating_calipers.h"
+
+#include <math.h>
+
+/**
+ * @brief Calculates twice the signed area of the triangle formed by three points.
+ * @param[in] a The first point to use.
+ * @param[in] b The second point to use.
+ * @param[in] c The third point to use.
+ * @return Twice the area, positive if the points are in counter-clockwise order.
+ */
+static double triangle_area(const Point* const a, const Point* const b, const Point* const c) {
+  return (b->x - a->x) * (c->y - a->y) - (b->y - a->y) * (c->x - a->x);
+}
+
+/**
+ * @brief Sets a line segment to a pair of points.
+ * @param[out] segment The line segment to set.
+ * @param[in] start The first endpoint to use.
+ * @param[in] end The second endpoint to use.
+ */
+static void set_line_segment(LineSegment* const segment, const Point* const start, const Point* const end) {
+  segment->start = *start;
+  segment->end = *end;
+  segment->length = distance(start, end);
+}
+
+/**
+ * @brief Sets every corner of a rectangle to a single point.
+ * @param[out] rectangle The rectangle to set.
+ * @param[in] point The point to use.
+ */
+static void set_point_rectangle(OrientedRectangle* const rectangle, const Point* const point) {
+  for (size_t i = 0; i < RECTANGLE_CORNER_COUNT; i++) {
+    rectangle->corners[i] = *point;
+  }
+
+  rectangle->area = 0;
+  rectangle->perimeter = 0;
+}
+
+/**
+ * @brief Rotates a pair of calipers around a convex hull to measure its diameter and width.
+ * @details For every edge, the caliper on the opposite side is advanced to the point farthest from the edge. Both ends
+ * of the edge form antipodal pairs with that point, and its distance from the edge is a candidate for the width.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @param[out] diameter The farthest pair of points, or `NULL` to skip it.
+ * @param[out] width The line segment across the narrowest edge, or `NULL` to skip it.
+ */
+static void rotate_antipodal_calipers(const Point* const convex_points, const size_t convex_point_cnt,
+                                      LineSegment* const diameter, LineSegment* const width) {
+  const Point origin = {0, 0};
+  const Point* const first_point = convex_point_cnt > 0 ? &convex_points[0] : &origin;
+
+  if (diameter) {
+    set_line_segment(diameter, first_point, first_point);
+  }
+
+  if (width) {
+    set_line_segment(width, first_point, first_point);
+  }
+
+  if (convex_point_cnt < 2) {
+    return;
+  }
+
+  size_t diameter_start_idx = 0;
+  size_t diameter_end_idx = 1;
+  double max_squared_length = squared_distance(&convex_points[0], &convex_points[1]);
+  size_t width_edge_idx = 0;
+  size_t width_point_idx = 0;
+  double min_width = INFINITY;
+  size_t far_idx = 1;
+
+  for (size_t i = 0; i < convex_point_cnt; i++) {
+    const Point* const edge_start = &convex_points[i];
+    const Point* const edge_end = &convex_points[(i + 1) % convex_point_cnt];
+
+    // the areas rise to the farthest point and fall after it, so the caliper never moves backwards
+    while (triangle_area(edge_start, edge_end, &convex_points[(far_idx + 1) % convex_point_cnt]) >
+           triangle_area(edge_start, edge_end, &convex_points[far_idx])) {
+      far_idx = (far_idx + 1) % convex_point_cnt;
+    }
+
+    const size_t end_idxs[] = {i, (i + 1) % convex_point_cnt};
+
+    for (size_t j = 0; j < 2; j++) {
+      const double squared_length = squared_distance(&convex_points[end_idxs[j]], &convex_points[far_idx]);
+
+      if (squared_length > max_squared_length) {
+        max_squared_length = squared_length;
+        diameter_start_idx = end_idxs[j];
+        diameter_end_idx = far_idx;
+      }
+    }
+
+    const double edge_width =
+        triangle_area(edge_start, edge_end, &convex_points[far_idx]) / distance(edge_start, edge_end);
+
+    if (edge_width < min_width) {
+      min_width = edge_width;
+      width_edge_idx = i;
+      width_point_idx = far_idx;
+    }
+  }
+
+  if (diameter) {
+    set_line_segment(diameter, &convex_points[diameter_start_idx], &convex_points[diameter_end_idx]);
+  }
+
+  // a line segment has no width, since its two sides are the same line
+  if (width && convex_point_cnt >= 3) {
+    const Point* const edge_start = &convex_points[width_edge_idx];
+    const Point* const edge_end = &convex_points[(width_edge_idx + 1) % convex_point_cnt];
+    const Point* const far_point = &convex_points[width_point_idx];
+    const double delta_x = edge_end->x - edge_start->x;
+    const double delta_y = edge_end->y - edge_start->y;
+    const double ratio = ((far_point->x - edge_start->x) * delta_x + (far_point->y - edge_start->y) * delta_y) /
+                         (delta_x * delta_x + delta_y * delta_y);
+    const Point projection = {edge_start->x + ratio * delta_x, edge_start->y + ratio * delta_y};
+
+    width->start = *far_point;
+    width->end = projection;
+    width->length = min_width;
+  }
+}
+
+/**
+ * @brief Calculates the distance of a point along an edge.
+ * @param[in] point The point to project.
+ * @param[in] origin The start of the edge.
+ * @param direction_x The x-coordinate of the edge's unit direction.
+ * @param direction_y The y-coordinate of the edge's unit direction.
+ * @return The distance of the point's projection from the start of the edge, positive towards the end of the edge.
+ */
+static double project_along_edge(const Point* const point, const Point* const origin, const double direction_x,
+                                 const double direction_y) {
+  return (point->x - origin->x) * direction_x + (point->y - origin->y) * direction_y;
+}
+
+/**
+ * @brief Calculates the distance of a point across an edge.
+ * @param[in] point The point to project.
+ * @param[in] origin The start of the edge.
+ * @param direction_x The x-coordinate of the edge's unit direction.
+ * @param direction_y The y-coordinate of the edge's unit direction.
+ * @return The distance of the point from the edge's line, positive to the left of the edge.
+ */
+static double project_across_edge(const Point* const point, const Point* const origin, const double direction_x,
+                                  const double direction_y) {
+  return (point->y - origin->y) * direction_x - (point->x - origin->x) * direction_y;
+}
+
+/**
+ * @brief Sets a rectangle to the one with a side containing an edge.
+ * @param[out] rectangle The rectangle to set.
+ * @param[in] origin The start of the edge.
+ * @param direction_x The x-coordinate of the edge's unit direction.
+ * @param direction_y The y-coordinate of the edge's unit direction.
+ * @param min_along The lowest distance along the edge of the enclosed points.
+ * @param max_along The highest distance along the edge of the enclosed points.
+ * @param max_across The highest distance across the edge of the enclosed points.
+ */
+static void set_edge_rectangle(OrientedRectangle* const rectangle, const Point* const origin, const double direction_x,
+                               const double direction_y, const double min_along, const double max_along,
+                               const double max_across) {
+  const double alongs[RECTANGLE_CORNER_COUNT] = {min_along, max_along, max_along, min_along};
+  const double acrosses[RECTANGLE_CORNER_COUNT] = {0, 0, max_across, max_across};
+
+  for (size_t i = 0; i < RECTANGLE_CORNER_COUNT; i++) {
+    rectangle->corners[i].x = origin->x + alongs[i] * direction_x - acrosses[i] * direction_y;
+    rectangle->corners[i].y = origin->y + alongs[i] * direction_y + acrosses[i] * direction_x;
+  }
+
+  rectangle->area = (max_along - min_along) * max_across;
+  rectangle->perimeter = 2 * (max_along - min_along + max_across);
+}
+
+/**
+ * @brief Rotates four calipers around a convex hull to locate its smallest enclosing rectangles.
+ * @details For every edge, the calipers on the other three sides are advanced to the farthest points forward of the
+ * edge, to the left of the edge, and backward of the edge. Together with the edge, they bound the enclosing rectangle
+ * with a side containing the edge.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @param[out] min_area_rectangle The rectangle with the smallest area, or `NULL` to skip it.
+ * @param[out] min_perimeter_rectangle The rectangle with the smallest perimeter, or `NULL` to skip it.
+ */
+static void rotate_rectangle_calipers(const Point* const convex_points, const size_t convex_point_cnt,
+                                      OrientedRectangle* const min_area_rectangle,
+                                      OrientedRectangle* const min_perimeter_rectangle) {
+  if (convex_point_cnt < 2) {
+    const Point origin = {0, 0};
+    const Point* const point = convex_point_cnt > 0 ? &convex_points[0] : &origin;
+
+    if (min_area_rectangle) {
+      set_point_rectangle(min_area_rectangle, point);
+    }
+
+    if (min_perimeter_rectangle) {
+      set_point_rectangle(min_perimeter_rectangle, point);
+    }
+
+    return;
+  }
+
+  double min_area = INFINITY;
+  double min_perimeter = INFINITY;
+  size_t forward_idx = 1;
+  size_t left_idx = 0;
+  size_t backward_idx = 0;
+
+  for (size_t i = 0; i < convex_point_cnt; i++) {
+    const Point* const edge_start = &convex_points[i];
+    const Point* const edge_end = &convex_points[(i + 1) % convex_point_cnt];
+    const double edge_length = distance(edge_start, edge_end);
+    const double direction_x = (edge_end->x - edge_start->x) / edge_length;
+    const double direction_y = (edge_end->y - edge_start->y) / edge_length;
+
+    while (project_along_edge(&convex_points[(forward_idx + 1) % convex_point_cnt], edge_start, direction_x,
+                              direction_y) >
+           project_along_edge(&convex_points[forward_idx], edge_start, direction_x, direction_y)) {
+      forward_idx = (forward_idx + 1) % convex_point_cnt;
+    }
+
+    // the calipers of the first edge start from the previous caliper, and never move backwards after it
+    if (i == 0) {
+      left_idx = forward_idx;
+    }
+
+    while (project_across_edge(&convex_points[(left_idx + 1) % convex_point_cnt], edge_start, direction_x,
+                               direction_y) >
+           project_across_edge(&convex_points[left_idx], edge_start, direction_x, direction_y)) {
+      left_idx = (left_idx + 1) % convex_point_cnt;
+    }
+
+    if (i == 0) {
+      backward_idx = left_idx;
+    }
+
+    while (project_along_edge(&convex_points[(backward_idx + 1) % convex_point_cnt], edge_start, direction_x,
+                              direction_y) <
+           project_along_edge(&convex_points[backward_idx], edge_start, direction_x, direction_y)) {
+      backward_idx = (backward_idx + 1) % convex_point_cnt;
+    }
+
+    const double min_along = project_along_edge(&convex_points[backward_idx], edge_start, direction_x, direction_y);
+    const double max_along = project_along_edge(&convex_points[forward_idx], edge_start, direction_x, direction_y);
+    const double max_across = project_across_edge(&convex_points[left_idx], edge_start, direction_x, direction_y);
+    const double area = (max_along - min_along) * max_across;
+    const double perimeter = 2 * (max_along - min_along + max_across);
+
+    if (min_area_rectangle && area < min_area) {
+      min_area = area;
+      set_edge_rectangle(min_area_rectangle, edge_start, direction_x, direction_y, min_along, max_along, max_across);
+    }
+
+    if (min_perimeter_rectangle && perimeter < min_perimeter) {
+      min_perimeter = perimeter;
+      set_edge_rectangle(min_perimeter_rectangle, edge_start, direction_x, direction_y, min_along, max_along,
+                         max_across);
+    }
+  }
+}
+
+/**
+ * @brief Locates the farthest pair of points of a convex hull.
+ * @details A pair of calipers is rotated around the convex hull, so only the `O(h)` antipodal pairs of points are
+ * compared instead of every pair. The points must be in the same order as the Graham scans, without collinear points.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @param[out] diameter The farthest pair of points, or a line segment of length zero if there are fewer than two.
+ */
+void find_hull_diameter(const Point* const convex_points, const size_t convex_point_cnt,
+                        LineSegment* const diameter) {
+  rotate_antipodal_calipers(convex_points, convex_point_cnt, diameter, NULL);
+}
+
+/**
+ * @brief Calculates the width of a convex hull, the shortest distance between two parallel lines that enclose it.
+ * @details One of the lines always contains an edge of the convex hull, so a pair of calipers is rotated around the
+ * convex hull, and only the point farthest from each edge is measured, which takes `O(h)` time. The points must be in
+ * the same order as the Graham scans, without collinear points.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @param[out] width The line segment from the point farthest from the narrowest edge to its projection onto the edge,
+ * or a line segment of length zero if there are fewer than three points.
+ */
+void find_hull_width(const Point* const convex_points, const size_t convex_point_cnt, LineSegment* const width) {
+  rotate_antipodal_calipers(convex_points, convex_point_cnt, NULL, width);
+}
+
+/**
+ * @brief Locates the rectangle with the smallest area that encloses a convex hull.
+ * @details One of the rectangle's sides always contains an edge of the convex hull, so four calipers are rotated around
+ * the convex hull, one per side, which takes `O(h)` time. The points must be in the same order as the Graham scans,
+ * without collinear points.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @param[out] rectangle The rectangle with the smallest area, which is flat if there are fewer than three points.
+ */
+void find_min_area_rectangle(const Point* const convex_points, const size_t convex_point_cnt,
+                             OrientedRectangle* const rectangle) {
+  rotate_rectangle_calipers(convex_points, convex_point_cnt, rectangle, NULL);
+}
+
+/**
+ * @brief Locates the rectangle with the smallest perimeter that encloses a convex hull.
+ * @details One of the rectangle's sides always contains an edge of the convex hull, so four calipers are rotated around
+ * the convex hull, one per side, which takes `O(h)` time. The points must be in the same order as the Graham scans,
+ * without collinear points.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @param[out] rectangle The rectangle with the smallest perimeter, which is flat if there are fewer than three points.
+ */
+void find_min_perimeter_rectangle(const Point* const convex_points, const size_t convex_point_cnt,
+                                  OrientedRectangle* const rectangle) {
+  rotate_rectangle_calipers(convex_points, convex_point_cnt, NULL, rectangle);
+}
+
+/**
+ * @brief Measures a convex hull.
+ * @details The calipers are rotated around the convex hull twice, once for the diameter and the width, and once for
+ * both rectangles, which is faster than finding each metric separately.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @param[out] metrics The measurements of the convex hull.
+ */
+void measure_hull(const Point* const convex_points, const size_t convex_point_cnt, HullMetrics* const metrics) {
+  rotate_antipodal_calipers(convex_points, convex_point_cnt, &metrics->diameter, &metrics->width);
+  rotate_rectangle_calipers(convex_points, convex_point_cnt, &metrics->min_area_rectangle,
+                            &metrics->min_perimeter_rectangle);
+}
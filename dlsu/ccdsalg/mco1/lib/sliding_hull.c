@@ -0,0 +1,167 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "convex_hull/sliding_hull.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief Removes the oldest point of a window.
+ * @param[in,out] hull The sliding convex hull to remove from. Its window must not be empty.
+ */
+static void pop_oldest_point(SlidingHull* const hull) {
+  remove_dynamic_hull_point(&hull->hull, hull->window[hull->first].point);
+
+  hull->first = (hull->first + 1) % hull->capacity;
+  hull->count--;
+}
+
+/**
+ * @brief Ensures that a window can contain one more point without growing.
+ * @details The ring buffer's capacity is doubled, and its points are unwrapped to start at the front.
+ * @param[in,out] hull The sliding convex hull to grow.
+ * @return Whether the window can contain one more point.
+ */
+static bool reserve_window_point(SlidingHull* const hull) {
+  if (hull->count < hull->capacity) {
+    return true;
+  }
+
+  if (hull->capacity > SIZE_MAX / 2 / sizeof(TimedPoint)) {
+    return false;
+  }
+
+  const size_t new_capacity = hull->capacity < MIN_SLIDING_WINDOW_CAPACITY ? MIN_SLIDING_WINDOW_CAPACITY
+                                                                           : hull->capacity * 2;
+  TimedPoint* const new_window = malloc(new_capacity * sizeof(TimedPoint));
+
+  if (!new_window) {
+    return false;
+  }
+
+  for (size_t i = 0; i < hull->count; i++) {
+    new_window[i] = hull->window[(hull->first + i) % hull->capacity];
+  }
+
+  free(hull->window);
+
+  hull->window = new_window;
+  hull->first = 0;
+  hull->capacity = new_capacity;
+
+  return true;
+}
+
+/**
+ * @brief Initializes a sliding convex hull to have an empty window.
+ * @details This doesn't allocate.
+ * @relates SlidingHull
+ * @param[in,out] hull The sliding convex hull to initialize.
+ * @param duration The number of seconds a point stays within the window, or zero if it isn't limited by time.
+ * @param max_cnt The maximum number of points within the window, or zero if it isn't limited by count.
+ */
+void create_sliding_hull(SlidingHull* const hull, const double duration, const size_t max_cnt) {
+  create_dynamic_hull(&hull->hull);
+
+  hull->window = NULL;
+  hull->first = 0;
+  hull->count = 0;
+  hull->capacity = 0;
+  hull->duration = duration;
+  hull->max_count = max_cnt;
+}
+
+/**
+ * @brief Removes the points that left the window by a time.
+ * @details A point leaves the window once `duration` seconds have passed since it arrived. The points are assumed to
+ * arrive in order, so only the oldest points are checked.
+ * @relates SlidingHull
+ * @param[in,out] hull The sliding convex hull to update.
+ * @param time The current time, in seconds.
+ */
+void expire_sliding_hull_points(SlidingHull* const hull, const double time) {
+  if (hull->duration <= 0) {
+    return;
+  }
+
+  while (hull->count > 0 && time - hull->window[hull->first].time >= hull->duration) {
+    pop_oldest_point(hull);
+  }
+}
+
+/**
+ * @brief Adds a point arriving at the end of the window.
+ * @details The points that left the window by the point's time are removed first, followed by the oldest point if the
+ * window is full. This takes `O(log^2 n)` amortized time per point added or removed.
+ * @relates SlidingHull
+ * @param[in,out] hull The sliding convex hull to add to.
+ * @param point The point to add.
+ * @return Whether the window could be grown to contain the point.
+ */
+bool push_sliding_hull_point(SlidingHull* const hull, const TimedPoint point) {
+  expire_sliding_hull_points(hull, point.time);
+
+  if (hull->max_count > 0 && hull->count == hull->max_count) {
+    pop_oldest_point(hull);
+  }
+
+  if (!reserve_window_point(hull) || !insert_dynamic_hull_point(&hull->hull, point.point)) {
+    return false;
+  }
+
+  hull->window[(hull->first + hull->count) % hull->capacity] = point;
+  hull->count++;
+
+  return true;
+}
+
+/**
+ * @brief Gets the number of points that make up the convex hull of a window.
+ * @relates SlidingHull
+ * @param[in] hull The sliding convex hull to use.
+ * @return The number of points from the convex set.
+ */
+size_t get_sliding_hull_point_count(const SlidingHull* const hull) { return get_dynamic_hull_point_count(&hull->hull); }
+
+/**
+ * @brief Copies the points that make up the convex hull of a window into a caller-owned array.
+ * @details The points are in the same order as the Graham scans: counter-clockwise, starting from the point with the
+ * lowest y-coordinate, and lowest x-coordinate if multiple.
+ * @relates SlidingHull
+ * @param[in] hull The sliding convex hull to use.
+ * @param[out] convex_points The array to copy the points from the convex set to. This must be able to contain
+ * `get_sliding_hull_point_count` points.
+ * @return The number of points from the convex set.
+ */
+size_t copy_sliding_hull_points(const SlidingHull* const hull, Point* const convex_points) {
+  return copy_dynamic_hull_points(&hull->hull, convex_points);
+}
+
+/**
+ * @brief Frees the window and the convex hull of a sliding convex hull.
+ * @details This empties the window, keeping its limits, so it can be reused.
+ * @relates SlidingHull
+ * @param[in,out] hull The sliding convex hull to free.
+ */
+void destroy_sliding_hull(SlidingHull* const hull) {
+  destroy_dynamic_hull(&hull->hull);
+  free(hull->window);
+
+  create_sliding_hull(hull, hull->duration, hull->max_count);
+}
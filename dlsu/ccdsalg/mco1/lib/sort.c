@@ -18,6 +18,36 @@
 
 #include "convex_hull/sort.h"
 
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** @brief The number of bits sorted by each pass of the radix sort. */
+#define RADIX_BITS 11
+
+/** @brief The number of buckets of each pass of the radix sort. */
+#define RADIX_BUCKET_COUNT (1 << RADIX_BITS)
+
+/** @brief The number of passes needed to sort a 64-bit key. */
+#define RADIX_PASS_COUNT ((64 + RADIX_BITS - 1) / RADIX_BITS)
+
+/**
+ * @brief The largest difference between two rounded pseudo-angles that can be in the opposite order of their exact
+ * pseudo-angles.
+ * @details A pseudo-angle's four roundings put it at most about `6 * ROUNDING_EPSILON` away from its exact value.
+ */
+#define PSEUDO_ANGLE_ERROR_BOUND (16 * ROUNDING_EPSILON)
+
+/** @brief A point decorated with its precalculated sort keys. */
+typedef struct SortRecord {
+  /** @brief The sortable bits of the point's squared distance from the anchor point. */
+  uint64_t distance_key;
+  /** @brief The sortable bits of the point's pseudo-angle around the anchor point. */
+  uint64_t angle_key;
+  /** @brief The point. */
+  Point point;
+} SortRecord;
+
 /**
  * @brief Swaps the points of two pointers.
  * @param[in,out] a The first pointer to swap the point of.
@@ -32,25 +62,17 @@ void swap(Point* const a, Point* const b) {
 /**
  * @brief Sorts points by their polar angle or distance in ascending order using the selection sort algorithm.
  * @details This sorts points by their polar angles by default. If multiple points share a polar angle, this sorts those
- * by their distances.
+ * by their distances. The points are compared with `is_larger`, so nearly collinear points are never misordered.
  * @param[in,out] points The points to sort.
  * @param point_cnt The number of points to sort.
- * @param[in] anchor_point The anchor or origin point to use.
+ * @param[in] anchor_point The anchor or origin point to use. This must be the lowest point, like `find_anchor_point`'s.
  */
 void selection_sort(Point* const points, const size_t point_cnt, const Point* const anchor_point) {
-  for (size_t i = 0; i < point_cnt - 1; i++) {
+  for (size_t i = 0; i + 1 < point_cnt; i++) {
     size_t smallest_idx = i;
 
     for (size_t j = i + 1; j < point_cnt; j++) {
-      const Point* const sorted_pt = &points[smallest_idx];
-      const double sorted_polar_angle = polar_angle(sorted_pt, anchor_point);
-
-      const Point* const unsorted_pt = &points[j];
-      const double unsorted_polar_angle = polar_angle(unsorted_pt, anchor_point);
-
-      if (unsorted_polar_angle < sorted_polar_angle ||
-          (unsorted_polar_angle == sorted_polar_angle &&
-           distance(anchor_point, unsorted_pt) < distance(anchor_point, sorted_pt))) {
+      if (is_larger(&points[smallest_idx], &points[j], anchor_point)) {
         smallest_idx = j;
       }
     }
@@ -64,17 +86,22 @@ void selection_sort(Point* const points, const size_t point_cnt, const Point* co
 /**
  * @brief Checks if a point is larger than another point.
  * @details This checks if the polar angle is greater, or if the distance is greater when the polar angles are equal.
+ * Neither is rounded. The polar angles are compared with the exact orientation of the points around the anchor point.
+ * Points sharing a polar angle are on the same ray from the anchor point, so the farther point is the higher point, or
+ * the point further right if the ray is horizontal.
  * @param[in] a The point to check.
  * @param[in] b The point to check against.
- * @param[in] anchor_point The anchor or origin point to use.
+ * @param[in] anchor_point The anchor or origin point to use. This must be the lowest point, like `find_anchor_point`'s.
  * @return Whether point `a` is larger than point `b`.
  */
 bool is_larger(const Point* const a, const Point* const b, const Point* const anchor_point) {
-  const double a_polar_angle = polar_angle(a, anchor_point);
-  const double b_polar_angle = polar_angle(b, anchor_point);
+  const int angle_orientation = orientation(anchor_point, a, b);
 
-  return a_polar_angle > b_polar_angle ||
-         (a_polar_angle == b_polar_angle && distance(anchor_point, a) > distance(anchor_point, b));
+  if (angle_orientation != 0) {
+    return angle_orientation < 0;
+  }
+
+  return a->y > b->y || (a->y == b->y && a->x > b->x);
 }
 
 /**
@@ -88,42 +115,271 @@ bool is_larger(const Point* const a, const Point* const b, const Point* const an
  */
 static void heapify(Point* const points, const size_t point_cnt, const size_t root_idx,
                     const Point* const anchor_point) {
-  size_t largest_idx = root_idx;
+  size_t parent_idx = root_idx;
 
-  const size_t left_idx = 2 * root_idx + 1;
-  const size_t right_idx = 2 * root_idx + 2;
+  while (true) {
+    size_t largest_idx = parent_idx;
 
-  if (left_idx < point_cnt && is_larger(&points[left_idx], &points[largest_idx], anchor_point)) {
-    largest_idx = left_idx;
-  }
+    const size_t left_idx = 2 * parent_idx + 1;
+    const size_t right_idx = 2 * parent_idx + 2;
 
-  if (right_idx < point_cnt && is_larger(&points[right_idx], &points[largest_idx], anchor_point)) {
-    largest_idx = right_idx;
-  }
+    if (left_idx < point_cnt && is_larger(&points[left_idx], &points[largest_idx], anchor_point)) {
+      largest_idx = left_idx;
+    }
+
+    if (right_idx < point_cnt && is_larger(&points[right_idx], &points[largest_idx], anchor_point)) {
+      largest_idx = right_idx;
+    }
+
+    if (largest_idx == parent_idx) {
+      return;
+    }
 
-  if (largest_idx != root_idx) {
-    swap(&points[root_idx], &points[largest_idx]);
+    swap(&points[parent_idx], &points[largest_idx]);
 
-    heapify(points, point_cnt, largest_idx, anchor_point);
+    parent_idx = largest_idx;
   }
 }
 
 /**
  * @brief Sorts points by their polar angle or distance in ascending order using the heap sort algorithm.
  * @details This sorts points by their polar angles by default. If multiple points share a polar angle, this sorts those
- * by their distances.
+ * by their distances. The points are compared with `is_larger`, so nearly collinear points are never misordered.
  * @param[in,out] points The points to sort.
  * @param point_cnt The number of points to sort.
- * @param[in] anchor_point The anchor or origin point to use.
+ * @param[in] anchor_point The anchor or origin point to use. This must be the lowest point, like `find_anchor_point`'s.
  */
 void heap_sort(Point* const points, const size_t point_cnt, const Point* const anchor_point) {
-  for (int i = point_cnt / 2 - 1; i >= 0; i--) {
-    heapify(points, point_cnt, i, anchor_point);
+  for (size_t i = point_cnt / 2; i > 0; i--) {
+    heapify(points, point_cnt, i - 1, anchor_point);
   }
 
-  for (int i = point_cnt - 1; i > 0; i--) {
+  for (size_t i = point_cnt - 1; point_cnt > 0 && i > 0; i--) {
     swap(&points[0], &points[i]);
 
     heapify(points, i, 0, anchor_point);
   }
 }
+
+/**
+ * @brief Checks if a point is lexicographically larger than another point.
+ * @details This checks if the x-coordinate is greater, or if the y-coordinate is greater when the x-coordinates are
+ * equal.
+ * @param[in] a The point to check.
+ * @param[in] b The point to check against.
+ * @return Whether point `a` is lexicographically larger than point `b`.
+ */
+bool is_lexicographically_larger(const Point* const a, const Point* const b) {
+  return a->x > b->x || (a->x == b->x && a->y > b->y);
+}
+
+/**
+ * @brief Converts an array starting from a root element into a lexicographically ordered max heap.
+ * @details This treats the array as the level order tree traversal sequence of a complete binary tree to build a max
+ * heap.
+ * @param[in,out] points The points to heapify.
+ * @param point_cnt The number of points to heapify.
+ * @param root_idx The index of the root point to use.
+ */
+static void heapify_lexicographically(Point* const points, const size_t point_cnt, const size_t root_idx) {
+  size_t parent_idx = root_idx;
+
+  while (true) {
+    size_t largest_idx = parent_idx;
+
+    const size_t left_idx = 2 * parent_idx + 1;
+    const size_t right_idx = 2 * parent_idx + 2;
+
+    if (left_idx < point_cnt && is_lexicographically_larger(&points[left_idx], &points[largest_idx])) {
+      largest_idx = left_idx;
+    }
+
+    if (right_idx < point_cnt && is_lexicographically_larger(&points[right_idx], &points[largest_idx])) {
+      largest_idx = right_idx;
+    }
+
+    if (largest_idx == parent_idx) {
+      return;
+    }
+
+    swap(&points[parent_idx], &points[largest_idx]);
+
+    parent_idx = largest_idx;
+  }
+}
+
+/**
+ * @brief Sorts points by their x-coordinate or y-coordinate in ascending order using the heap sort algorithm.
+ * @details This sorts points by their x-coordinates by default. If multiple points share an x-coordinate, this sorts
+ * those by their y-coordinates. Unlike `heap_sort`, this needs no anchor point.
+ * @param[in,out] points The points to sort.
+ * @param point_cnt The number of points to sort.
+ */
+void lexicographic_sort(Point* const points, const size_t point_cnt) {
+  for (size_t i = point_cnt / 2; i > 0; i--) {
+    heapify_lexicographically(points, point_cnt, i - 1);
+  }
+
+  for (size_t i = point_cnt - 1; point_cnt > 0 && i > 0; i--) {
+    swap(&points[0], &points[i]);
+
+    heapify_lexicographically(points, i, 0);
+  }
+}
+
+/**
+ * @brief Sorts points by their x-coordinate or y-coordinate in ascending order using the insertion sort algorithm.
+ * @details This sorts points like `lexicographic_sort`, but is faster for a few dozen points, since it has no heap to
+ * build and moves each point only past the larger points before it.
+ * @param[in,out] points The points to sort.
+ * @param point_cnt The number of points to sort.
+ */
+void lexicographic_insertion_sort(Point* const points, const size_t point_cnt) {
+  for (size_t i = 1; i < point_cnt; i++) {
+    const Point point = points[i];
+    size_t insert_idx = i;
+
+    while (insert_idx > 0 && is_lexicographically_larger(&points[insert_idx - 1], &point)) {
+      points[insert_idx] = points[insert_idx - 1];
+      insert_idx--;
+    }
+
+    points[insert_idx] = point;
+  }
+}
+
+/**
+ * @brief Converts a double into bits that order like the double when compared as unsigned integers.
+ * @details Negative doubles have all their bits flipped, and positive doubles only their sign bit.
+ * @param value The double to convert.
+ * @return The sortable bits of the double.
+ */
+static uint64_t to_sortable_bits(const double value) {
+  uint64_t bits;
+
+  memcpy(&bits, &value, sizeof(bits));
+
+  return bits >> 63 ? ~bits : bits | (UINT64_C(1) << 63);
+}
+
+/**
+ * @brief Converts the bits from `to_sortable_bits` back into the double.
+ * @param bits The sortable bits to convert.
+ * @return The double of the bits.
+ */
+static double from_sortable_bits(const uint64_t bits) {
+  const uint64_t value_bits = bits >> 63 ? bits & ~(UINT64_C(1) << 63) : ~bits;
+  double value;
+
+  memcpy(&value, &value_bits, sizeof(value));
+
+  return value;
+}
+
+/**
+ * @brief Extracts the digit of a key sorted by a pass of the radix sort.
+ * @param[in] record The record to extract the digit from.
+ * @param pass The pass to extract the digit for. The distance is sorted by the first passes, and the angle by the rest.
+ * @return The digit of the key.
+ */
+static size_t radix_digit(const SortRecord* const record, const size_t pass) {
+  const uint64_t key = pass < RADIX_PASS_COUNT ? record->distance_key : record->angle_key;
+
+  return (size_t)(key >> (pass % RADIX_PASS_COUNT * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1);
+}
+
+/**
+ * @brief Sorts points by their polar angle or distance in ascending order using the radix sort algorithm.
+ * @details This sorts points by their polar angles by default. If multiple points share a polar angle, this sorts those
+ * by their distances. Instead of comparing points, each point's pseudo-angle and squared distance are calculated once
+ * and stored with it. The records are then sorted by the bits of their keys, least significant first, and the points
+ * are copied back in order. Passes where every record has the same digit are skipped. The pseudo-angles are rounded,
+ * so every run of points whose pseudo-angles are within their rounding error of each other is sorted again with
+ * `heap_sort`, which compares them exactly.
+ * @param[in,out] points The points to sort.
+ * @param point_cnt The number of points to sort.
+ * @param[in] anchor_point The anchor or origin point to use. This must be the lowest point, like `find_anchor_point`'s.
+ * @return Whether the memory for the records could be allocated. The points are left unsorted if not.
+ */
+bool radix_sort(Point* const points, const size_t point_cnt, const Point* const anchor_point) {
+  if (point_cnt < 2) {
+    return true;
+  }
+
+  if (point_cnt > SIZE_MAX / 2 / sizeof(SortRecord)) {
+    return false;
+  }
+
+  SortRecord* records = malloc(2 * point_cnt * sizeof(SortRecord));
+  size_t* const bucket_cnts = calloc(2 * RADIX_PASS_COUNT * RADIX_BUCKET_COUNT, sizeof(size_t));
+
+  if (!records || !bucket_cnts) {
+    free(records);
+    free(bucket_cnts);
+
+    return false;
+  }
+
+  SortRecord* sorted_records = &records[point_cnt];
+  SortRecord* const allocated_records = records;
+
+  // every pass's buckets are counted in a single walk over the points
+  for (size_t i = 0; i < point_cnt; i++) {
+    SortRecord* const record = &records[i];
+
+    record->distance_key = to_sortable_bits(squared_distance(&points[i], anchor_point));
+    record->angle_key = to_sortable_bits(pseudo_angle(&points[i], anchor_point));
+    record->point = points[i];
+
+    for (size_t pass = 0; pass < 2 * RADIX_PASS_COUNT; pass++) {
+      bucket_cnts[pass * RADIX_BUCKET_COUNT + radix_digit(record, pass)]++;
+    }
+  }
+
+  for (size_t pass = 0; pass < 2 * RADIX_PASS_COUNT; pass++) {
+    size_t* const pass_bucket_cnts = &bucket_cnts[pass * RADIX_BUCKET_COUNT];
+
+    if (pass_bucket_cnts[radix_digit(&records[0], pass)] == point_cnt) {
+      continue;
+    }
+
+    size_t bucket_start_idx = 0;
+
+    for (size_t i = 0; i < RADIX_BUCKET_COUNT; i++) {
+      const size_t bucket_cnt = pass_bucket_cnts[i];
+
+      pass_bucket_cnts[i] = bucket_start_idx;
+      bucket_start_idx += bucket_cnt;
+    }
+
+    for (size_t i = 0; i < point_cnt; i++) {
+      sorted_records[pass_bucket_cnts[radix_digit(&records[i], pass)]++] = records[i];
+    }
+
+    SortRecord* const swapped_records = records;
+
+    records = sorted_records;
+    sorted_records = swapped_records;
+  }
+
+  size_t run_start_idx = 0;
+
+  // only points whose rounded pseudo-angles are too close to call can be out of order, so only their runs are resorted
+  for (size_t i = 0; i < point_cnt; i++) {
+    points[i] = records[i].point;
+
+    if (i + 1 == point_cnt || from_sortable_bits(records[i + 1].angle_key) - from_sortable_bits(records[i].angle_key) >
+                                  PSEUDO_ANGLE_ERROR_BOUND) {
+      if (i > run_start_idx) {
+        heap_sort(&points[run_start_idx], i + 1 - run_start_idx, anchor_point);
+      }
+
+      run_start_idx = i + 1;
+    }
+  }
+
+  free(allocated_records);
+  free(bucket_cnts);
+
+  return true;
+}
@@ -21,12 +21,18 @@
 #include <stdint.h>
 
 /**
- * @brief Initializes a stack's elements and top index to their default values.
+ * @brief Initializes a stack's elements, top index, and capacity to their default values.
  * @details This sets the stack's top index to `SIZE_MAX`.
  * @relates Stack
  * @param[in,out] stack The stack to initialize.
+ * @param[in] elms The array to store the stack's elements in.
+ * @param capacity The number of elements the array can contain.
  */
-void create(Stack* const stack) { stack->top = SIZE_MAX; }
+void create(Stack* const stack, Point* const elms, const size_t capacity) {
+  stack->elements = elms;
+  stack->top = SIZE_MAX;
+  stack->capacity = capacity;
+}
 
 /**
  * @brief Adds an element into the top of a stack.
@@ -78,12 +84,12 @@ const Point* next_to_top(Stack* const stack) {
 
 /**
  * @brief Checks if a stack contains the maximum number of elements.
- * @details This checks if the stack's top index is one less than `MAX_STACK_SIZE` (`MAX_STACK_SIZE - 1`).
+ * @details This checks if the stack's top index is one less than its capacity (`capacity - 1`).
  * @relates Stack
  * @param[in] stack The stack to check.
  * @return Whether the stack contains the maximum number of elements.
  */
-bool is_full(const Stack* const stack) { return stack->top == MAX_STACK_SIZE - 1; }
+bool is_full(const Stack* const stack) { return stack->top == stack->capacity - 1; }
 
 /**
  * @brief Checks if a stack contains no elements.
@@ -0,0 +1,1330 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "convex_hull/approximate_hull.h"
+#include "convex_hull/batch_scan.h"
+#include "convex_hull/chan_scan.h"
+#include "convex_hull/culling.h"
+#include "convex_hull/dynamic_hull.h"
+#include "convex_hull/graham_scan.h"
+#include "convex_hull/graham_scan1.h"
+#include "convex_hull/graham_scan2.h"
+#include "convex_hull/hull_query.h"
+#include "convex_hull/incremental_hull.h"
+#include "convex_hull/kernels.h"
+#include "convex_hull/monotone_chain.h"
+#include "convex_hull/parallel_scan.h"
+#include "convex_hull/point_soa.h"
+#include "convex_hull/quick_hull.h"
+#include "convex_hull/sliding_hull.h"
+#include "convex_hull/sort.h"
+
+/** @brief The number of decimal digits of the smallest generated input size (`10^3`). */
+#define MIN_SIZE_EXPONENT 3
+
+/** @brief The number of decimal digits of the largest generated input size by default (`10^6`). */
+#define DEFAULT_MAX_SIZE_EXPONENT 6
+
+/** @brief The number of decimal digits of the largest input size that can be generated (`10^8`). */
+#define MAX_SIZE_EXPONENT 8
+
+/** @brief The number of times each engine is run on each input by default. */
+#define DEFAULT_RUN_COUNT 5
+
+/** @brief The seed of the input generator by default. */
+#define DEFAULT_SEED 1
+
+/** @brief The largest input the slow Graham scan is run on, since its sorting takes quadratic time. */
+#define MAX_SLOW_POINT_COUNT 10000
+
+/** @brief The number of clusters of the clustered distribution. */
+#define CLUSTER_COUNT 16
+
+/** @brief The standard deviation of the points around their cluster's center. */
+#define CLUSTER_DEVIATION 0.05
+
+/** @brief The most units in the last place the near-collinear distribution moves each coordinate by. */
+#define MAX_COLLINEAR_ULP_SHIFT 4
+
+/** @brief The value of pi. */
+#define PI 3.14159265358979323846
+
+/** @brief A value in place of a phase's duration, when the engine doesn't have the phase. */
+#define MISSING_DURATION (-1)
+
+/** @brief The shapes of the generated inputs. */
+typedef enum Distribution {
+  /** @brief Points uniformly spread inside a square. */
+  SQUARE_DISTRIBUTION,
+  /** @brief Points uniformly spread inside a disk. */
+  DISK_DISTRIBUTION,
+  /** @brief Points on a circle, so every point is part of the convex hull. */
+  CIRCLE_DISTRIBUTION,
+  /** @brief Points normally spread around the origin. */
+  GAUSSIAN_DISTRIBUTION,
+  /** @brief Points normally spread around a few random centers. */
+  CLUSTERED_DISTRIBUTION,
+  /** @brief Points on a line moved by a few units in the last place, so their orientations are too close to round. */
+  COLLINEAR_DISTRIBUTION,
+  /** @brief The number of distributions. */
+  DISTRIBUTION_COUNT,
+} Distribution;
+
+/** @brief The names of the distributions, as printed in the results. */
+static const char* const DISTRIBUTION_NAMES[DISTRIBUTION_COUNT] = {"square",   "disk",      "circle",
+                                                                   "gaussian", "clustered", "collinear"};
+
+/** @brief The durations of the phases of a single run of an engine, in nanoseconds. */
+typedef struct PhaseDurations {
+  /** @brief The duration of locating the anchor point, or `MISSING_DURATION`. */
+  int64_t anchor;
+  /** @brief The duration of sorting the points, or `MISSING_DURATION`. */
+  int64_t sort;
+  /** @brief The duration of scanning the sorted points, or `MISSING_DURATION`. */
+  int64_t scan;
+  /** @brief The duration of the whole run. */
+  int64_t total;
+} PhaseDurations;
+
+/**
+ * @brief A function that finds the convex hull of points while timing its phases.
+ * @param[in,out] points The points to scan. This will be mutated.
+ * @param point_count The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to. This must be able to
+ * contain all of the points.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set, or `SIZE_MAX` if the engine failed.
+ */
+typedef size_t (*Engine)(Point* const points, size_t point_count, Point* const convex_points,
+                         PhaseDurations* const durations);
+
+/** @brief The number of threads the parallel and the QuickHull engines use. */
+static size_t parallel_thread_count = 1;
+
+/**
+ * @brief Gets the current time of a monotonic clock.
+ * @return The current time in nanoseconds.
+ */
+static int64_t get_time(void) {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return (int64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+}
+
+/**
+ * @brief Generates the next pseudo-random number of a SplitMix64 generator.
+ * @details This is used instead of `rand`, so the same seed generates the same inputs on every platform.
+ * @param[in,out] state The state of the generator.
+ * @return The next pseudo-random number.
+ */
+static uint64_t next_random(uint64_t* const state) {
+  uint64_t value = (*state += UINT64_C(0x9E3779B97F4A7C15));
+
+  value = (value ^ (value >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  value = (value ^ (value >> 27)) * UINT64_C(0x94D049BB133111EB);
+
+  return value ^ (value >> 31);
+}
+
+/**
+ * @brief Generates a pseudo-random number uniformly spread between zero, inclusive, and one, exclusive.
+ * @param[in,out] state The state of the generator.
+ * @return The pseudo-random number.
+ */
+static double next_uniform(uint64_t* const state) {
+  return (double)(next_random(state) >> 11) / 9007199254740992.0;
+}
+
+/**
+ * @brief Generates a pseudo-random number normally spread around zero with a standard deviation of one.
+ * @details This uses the Box-Muller transform.
+ * @param[in,out] state The state of the generator.
+ * @return The pseudo-random number.
+ */
+static double next_gaussian(uint64_t* const state) {
+  const double radius = sqrt(-2 * log(1 - next_uniform(state)));
+
+  return radius * cos(2 * PI * next_uniform(state));
+}
+
+/**
+ * @brief Moves a double by a pseudo-random number of units in the last place, up to `MAX_COLLINEAR_ULP_SHIFT` either
+ * way.
+ * @param value The double to move.
+ * @param[in,out] state The state of the generator.
+ * @return The moved double.
+ */
+static double shift_ulps(const double value, uint64_t* const state) {
+  const int shift = (int)(next_random(state) % (2 * MAX_COLLINEAR_ULP_SHIFT + 1)) - MAX_COLLINEAR_ULP_SHIFT;
+  double shifted_value = value;
+
+  for (int i = 0; i < abs(shift); i++) {
+    shifted_value = nextafter(shifted_value, shift > 0 ? INFINITY : -INFINITY);
+  }
+
+  return shifted_value;
+}
+
+/**
+ * @brief Generates points following a distribution.
+ * @param[out] points The generated points.
+ * @param point_cnt The number of points to generate.
+ * @param distribution The distribution to follow.
+ * @param seed The seed of the generator.
+ */
+static void generate_points(Point* const points, const size_t point_cnt, const Distribution distribution,
+                            const uint64_t seed) {
+  uint64_t state = seed ^ ((uint64_t)distribution << 32) ^ point_cnt;
+  Point cluster_centers[CLUSTER_COUNT];
+
+  for (size_t i = 0; i < CLUSTER_COUNT; i++) {
+    cluster_centers[i].x = 2 * next_uniform(&state) - 1;
+    cluster_centers[i].y = 2 * next_uniform(&state) - 1;
+  }
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    Point* const pt = &points[i];
+
+    switch (distribution) {
+      case SQUARE_DISTRIBUTION:
+        pt->x = 2 * next_uniform(&state) - 1;
+        pt->y = 2 * next_uniform(&state) - 1;
+        break;
+      case DISK_DISTRIBUTION: {
+        const double radius = sqrt(next_uniform(&state));
+        const double angle = 2 * PI * next_uniform(&state);
+
+        pt->x = radius * cos(angle);
+        pt->y = radius * sin(angle);
+        break;
+      }
+      case CIRCLE_DISTRIBUTION: {
+        const double angle = 2 * PI * next_uniform(&state);
+
+        pt->x = cos(angle);
+        pt->y = sin(angle);
+        break;
+      }
+      case GAUSSIAN_DISTRIBUTION:
+        pt->x = next_gaussian(&state);
+        pt->y = next_gaussian(&state);
+        break;
+      case COLLINEAR_DISTRIBUTION: {
+        // the line is the one between the first two cluster centers
+        const double position = next_uniform(&state);
+
+        pt->x = shift_ulps(cluster_centers[0].x + position * (cluster_centers[1].x - cluster_centers[0].x), &state);
+        pt->y = shift_ulps(cluster_centers[0].y + position * (cluster_centers[1].y - cluster_centers[0].y), &state);
+        break;
+      }
+      default: {
+        const Point* const center = &cluster_centers[next_random(&state) % CLUSTER_COUNT];
+
+        pt->x = center->x + CLUSTER_DEVIATION * next_gaussian(&state);
+        pt->y = center->y + CLUSTER_DEVIATION * next_gaussian(&state);
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Runs a Graham scan while timing its phases.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param[out] durations The durations of the phases.
+ * @param sort The sort to use, either `selection_sort` or `heap_sort`.
+ * @return The number of points from the created convex set.
+ */
+static size_t run_graham_scan(Point* const points, const size_t point_cnt, Point* const convex_points,
+                              PhaseDurations* const durations,
+                              void (*const sort)(Point* const, size_t, const Point* const)) {
+  const int64_t start_time = get_time();
+  const Point anchor_point = find_anchor_point(points, point_cnt);
+  const int64_t anchor_time = get_time();
+
+  sort(points, point_cnt, &anchor_point);
+
+  const int64_t sort_time = get_time();
+  size_t convex_point_cnt = 0;
+
+  scan_sorted_points_into(points, point_cnt, &anchor_point, convex_points, point_cnt, &convex_point_cnt);
+
+  const int64_t scan_time = get_time();
+
+  durations->anchor = anchor_time - start_time;
+  durations->sort = sort_time - anchor_time;
+  durations->scan = scan_time - sort_time;
+  durations->total = scan_time - start_time;
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Runs the slow Graham scan, which sorts with the selection sort algorithm, while timing its phases.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set.
+ */
+static size_t run_slow_scan(Point* const points, const size_t point_cnt, Point* const convex_points,
+                            PhaseDurations* const durations) {
+  return run_graham_scan(points, point_cnt, convex_points, durations, selection_sort);
+}
+
+/**
+ * @brief Runs the fast Graham scan, which sorts with the heap sort algorithm, while timing its phases.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set.
+ */
+static size_t run_fast_scan(Point* const points, const size_t point_cnt, Point* const convex_points,
+                            PhaseDurations* const durations) {
+  return run_graham_scan(points, point_cnt, convex_points, durations, heap_sort);
+}
+
+/**
+ * @brief Runs the Graham scan that sorts with the radix sort algorithm on precalculated keys, while timing its phases.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set, or `SIZE_MAX` if the keys couldn't be allocated.
+ */
+static size_t run_radix_scan(Point* const points, const size_t point_cnt, Point* const convex_points,
+                             PhaseDurations* const durations) {
+  const int64_t start_time = get_time();
+  const Point anchor_point = find_anchor_point(points, point_cnt);
+  const int64_t anchor_time = get_time();
+
+  if (!radix_sort(points, point_cnt, &anchor_point)) {
+    return SIZE_MAX;
+  }
+
+  const int64_t sort_time = get_time();
+  size_t convex_point_cnt = 0;
+
+  scan_sorted_points_into(points, point_cnt, &anchor_point, convex_points, point_cnt, &convex_point_cnt);
+
+  const int64_t scan_time = get_time();
+
+  durations->anchor = anchor_time - start_time;
+  durations->sort = sort_time - anchor_time;
+  durations->scan = scan_time - sort_time;
+  durations->total = scan_time - start_time;
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Runs Andrew's monotone chain algorithm while timing its phases.
+ * @details The monotone chain has no anchor point, so only the sorting and the scanning are timed.
+ * @param[in,out] points The points to scan. This will be mutated to be sorted.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set.
+ */
+static size_t run_monotone_chain_scan(Point* const points, const size_t point_cnt, Point* const convex_points,
+                                      PhaseDurations* const durations) {
+  const int64_t start_time = get_time();
+
+  lexicographic_sort(points, point_cnt);
+
+  const int64_t sort_time = get_time();
+  size_t convex_point_cnt = 0;
+
+  monotone_chain_scan_sorted_into(points, point_cnt, convex_points, point_cnt, &convex_point_cnt);
+
+  const int64_t scan_time = get_time();
+
+  durations->anchor = MISSING_DURATION;
+  durations->sort = sort_time - start_time;
+  durations->scan = scan_time - sort_time;
+  durations->total = scan_time - start_time;
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Runs the multithreaded divide and conquer scan.
+ * @details Every thread runs its own phases, so only the whole run is timed.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points Unused, since the convex set is found in place.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set.
+ */
+static size_t run_parallel_scan(Point* const points, const size_t point_cnt, Point* const convex_points,
+                                PhaseDurations* const durations) {
+  (void)convex_points;
+
+  const int64_t start_time = get_time();
+  const size_t convex_point_cnt = parallel_scan_in_place(points, point_cnt, parallel_thread_count, fast_scan_in_place);
+
+  durations->anchor = MISSING_DURATION;
+  durations->sort = MISSING_DURATION;
+  durations->scan = MISSING_DURATION;
+  durations->total = get_time() - start_time;
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Runs Chan's algorithm.
+ * @details The groups are scanned and wrapped once per round, so only the whole run is timed.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points Unused, since the convex set is found in place.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set.
+ */
+static size_t run_chan_scan(Point* const points, const size_t point_cnt, Point* const convex_points,
+                            PhaseDurations* const durations) {
+  (void)convex_points;
+
+  const int64_t start_time = get_time();
+  const size_t convex_point_cnt = chan_scan_in_place(points, point_cnt);
+
+  durations->anchor = MISSING_DURATION;
+  durations->sort = MISSING_DURATION;
+  durations->scan = MISSING_DURATION;
+  durations->total = get_time() - start_time;
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Runs the multithreaded QuickHull algorithm.
+ * @details Every thread solves its own subproblems, so only the whole run is timed.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points Unused, since the convex set is found in place.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set.
+ */
+static size_t run_quick_hull(Point* const points, const size_t point_cnt, Point* const convex_points,
+                             PhaseDurations* const durations) {
+  (void)convex_points;
+
+  const int64_t start_time = get_time();
+  const size_t convex_point_cnt = parallel_quick_hull_in_place(points, point_cnt, parallel_thread_count);
+
+  durations->anchor = MISSING_DURATION;
+  durations->sort = MISSING_DURATION;
+  durations->scan = MISSING_DURATION;
+  durations->total = get_time() - start_time;
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Runs the approximate Bentley-Faust-Preparata algorithm with `DEFAULT_APPROXIMATE_STRIP_COUNT` strips.
+ * @details The strips are filled in a single pass, so only the whole run is timed.
+ * @param[in,out] points The points to scan. This will be mutated to start with the points from the created convex set.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points Unused, since the convex set is found in place.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set.
+ */
+static size_t run_approximate_hull(Point* const points, const size_t point_cnt, Point* const convex_points,
+                                   PhaseDurations* const durations) {
+  (void)convex_points;
+
+  const int64_t start_time = get_time();
+  const size_t convex_point_cnt = approximate_hull_in_place(points, point_cnt);
+
+  durations->anchor = MISSING_DURATION;
+  durations->sort = MISSING_DURATION;
+  durations->scan = MISSING_DURATION;
+  durations->total = get_time() - start_time;
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Runs the faster Graham scan after culling the interior points.
+ * @details The culling and the faster Graham scan's phases aren't separated, so only the whole run is timed.
+ * @param[in,out] points The points to scan. This will be mutated to start with the culled points.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set.
+ */
+static size_t run_cull_scan(Point* const points, const size_t point_cnt, Point* const convex_points,
+                            PhaseDurations* const durations) {
+  const int64_t start_time = get_time();
+  const size_t culled_point_cnt = cull_interior_points(points, point_cnt, OCTAGON_DIRECTION_COUNT);
+  size_t convex_point_cnt = 0;
+
+  fast_scan_into(points, culled_point_cnt, convex_points, point_cnt, &convex_point_cnt);
+
+  durations->anchor = MISSING_DURATION;
+  durations->sort = MISSING_DURATION;
+  durations->scan = MISSING_DURATION;
+  durations->total = get_time() - start_time;
+
+  return convex_point_cnt;
+}
+
+/**
+ * @brief Runs the faster Graham scan after culling the interior points from a structure of arrays.
+ * @details The points are copied into the structure of arrays and back as part of the run, and the culling and the
+ * faster Graham scan's phases aren't separated, so only the whole run is timed.
+ * @param[in,out] points The points to scan. This will be mutated to start with the culled points.
+ * @param point_cnt The number of points to scan.
+ * @param[out] convex_points The array to write the points from the created convex set to.
+ * @param[out] durations The durations of the phases.
+ * @return The number of points from the created convex set, or `SIZE_MAX` if the structure of arrays couldn't be
+ * allocated.
+ */
+static size_t run_soa_cull_scan(Point* const points, const size_t point_cnt, Point* const convex_points,
+                                PhaseDurations* const durations) {
+  const int64_t start_time = get_time();
+  PointSoA soa_points;
+
+  create_point_soa(&soa_points);
+
+  if (!copy_points_to_soa(&soa_points, points, point_cnt)) {
+    destroy_point_soa(&soa_points);
+
+    return SIZE_MAX;
+  }
+
+  const size_t culled_point_cnt = cull_interior_points_soa(&soa_points, OCTAGON_DIRECTION_COUNT);
+  size_t convex_point_cnt = 0;
+
+  copy_points_from_soa(&soa_points, points);
+  destroy_point_soa(&soa_points);
+  fast_scan_into(points, culled_point_cnt, convex_points, point_cnt, &convex_point_cnt);
+
+  durations->anchor = MISSING_DURATION;
+  durations->sort = MISSING_DURATION;
+  durations->scan = MISSING_DURATION;
+  durations->total = get_time() - start_time;
+
+  return convex_point_cnt;
+}
+
+/** @brief The number of benchmarked engines. */
+#define ENGINE_COUNT 10
+
+/** @brief The benchmarked engines. */
+static const Engine ENGINES[ENGINE_COUNT] = {run_slow_scan,           run_fast_scan,        run_radix_scan,
+                                            run_monotone_chain_scan, run_parallel_scan,    run_chan_scan,
+                                            run_quick_hull,          run_approximate_hull, run_cull_scan,
+                                            run_soa_cull_scan};
+
+/** @brief The names of the benchmarked engines, as printed in the results. */
+static const char* const ENGINE_NAMES[ENGINE_COUNT] = {"slow", "fast",  "radix",       "monotone", "parallel",
+                                                       "chan", "quick", "approximate", "cull",     "cull_soa"};
+
+/** @brief The fewest points of a group in the batch scan check. */
+#define MIN_CHECK_GROUP_SIZE 3
+
+/** @brief The number of different group sizes in the batch scan check, so both of its sorts are used. */
+#define CHECK_GROUP_SIZE_COUNT 64
+
+/** @brief The number of windows of the sliding hull check that the points fill. */
+#define CHECK_WINDOW_COUNT 4
+
+/** @brief The number of inputs of fewer than three points, or of one repeated point, in the degenerate input check. */
+#define DEGENERATE_INPUT_COUNT 5
+
+/** @brief The most points of an input in the degenerate input check. */
+#define MAX_DEGENERATE_POINT_COUNT 3
+
+/** @brief The number of in-place scans in the degenerate input check. */
+#define DEGENERATE_SCAN_COUNT 4
+
+/** @brief How far the hull query check moves every vertex of the convex hull away from its center. */
+#define CHECK_PROBE_OFFSET 0.001
+
+/**
+ * @brief A function that checks a library API against the convex hull found by the faster Graham scan.
+ * @param[in] points The points the convex hull was found from.
+ * @param point_count The number of points.
+ * @param[in] convex_points The points from the convex set found by the faster Graham scan.
+ * @param convex_point_count The number of points from the convex set.
+ * @return Whether the API agreed with the convex set, `false` if it couldn't be allocated.
+ */
+typedef bool (*Check)(const Point* const points, size_t point_count, const Point* const convex_points,
+                      size_t convex_point_count);
+
+/**
+ * @brief Checks if two convex sets have the same points in the same order.
+ * @param[in] points The points from the first convex set.
+ * @param point_cnt The number of points from the first convex set.
+ * @param[in] expected_points The points from the second convex set.
+ * @param expected_point_cnt The number of points from the second convex set.
+ * @return Whether both convex sets are the same.
+ */
+static bool is_same_convex_set(const Point* const points, const size_t point_cnt, const Point* const expected_points,
+                               const size_t expected_point_cnt) {
+  if (point_cnt != expected_point_cnt) {
+    return false;
+  }
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    if (points[i].x != expected_points[i].x || points[i].y != expected_points[i].y) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Checks that the Graham scans find the same convex hull as Andrew's monotone chain algorithm.
+ * @details The monotone chain sorts the points by their coordinates, which are never rounded, so it is exact for every
+ * input. The slow Graham scan is only checked up to `MAX_SLOW_POINT_COUNT` points.
+ * @param[in] points The points to scan.
+ * @param point_cnt The number of points to scan.
+ * @param[in] convex_points The points from the convex set found by the faster Graham scan.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @return Whether every convex set is the same.
+ */
+static bool check_graham_scans(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                               const size_t convex_point_cnt) {
+  Point* const scanned_points = malloc(point_cnt * sizeof(Point));
+  Point* const expected_points = malloc(point_cnt * sizeof(Point));
+  size_t expected_point_cnt = 0;
+  bool is_passed = scanned_points && expected_points;
+
+  if (is_passed) {
+    memcpy(scanned_points, points, point_cnt * sizeof(Point));
+    monotone_chain_scan_into(scanned_points, point_cnt, expected_points, point_cnt, &expected_point_cnt);
+
+    is_passed = is_same_convex_set(convex_points, convex_point_cnt, expected_points, expected_point_cnt);
+  }
+
+  if (is_passed) {
+    memcpy(scanned_points, points, point_cnt * sizeof(Point));
+
+    is_passed = is_same_convex_set(scanned_points, fast_scan_in_place(scanned_points, point_cnt), expected_points,
+                                   expected_point_cnt);
+  }
+
+  if (is_passed && point_cnt <= MAX_SLOW_POINT_COUNT) {
+    memcpy(scanned_points, points, point_cnt * sizeof(Point));
+
+    is_passed = is_same_convex_set(scanned_points, slow_scan_in_place(scanned_points, point_cnt), expected_points,
+                                   expected_point_cnt);
+  }
+
+  free(scanned_points);
+  free(expected_points);
+
+  return is_passed;
+}
+
+/**
+ * @brief Checks that an in-place scan finds the same convex hull as the faster Graham scan.
+ * @param scan The in-place scan to check.
+ * @param[in] points The points to scan.
+ * @param point_cnt The number of points to scan.
+ * @param[in] convex_points The points from the convex set found by the faster Graham scan.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @return Whether the convex set is the same.
+ */
+static bool check_in_place_scan(const InPlaceScan scan, const Point* const points, const size_t point_cnt,
+                                const Point* const convex_points, const size_t convex_point_cnt) {
+  Point* const scanned_points = malloc(point_cnt * sizeof(Point));
+
+  if (!scanned_points) {
+    return false;
+  }
+
+  memcpy(scanned_points, points, point_cnt * sizeof(Point));
+
+  const bool is_passed = is_same_convex_set(scanned_points, scan(scanned_points, point_cnt), convex_points,
+                                            convex_point_cnt);
+
+  free(scanned_points);
+
+  return is_passed;
+}
+
+/**
+ * @brief Checks that Chan's algorithm finds the same convex hull as the faster Graham scan.
+ * @details The tangent searches rely on every group's convex hull being strictly convex, which near-collinear inputs
+ * test the most.
+ * @param[in] points The points to scan.
+ * @param point_cnt The number of points to scan.
+ * @param[in] convex_points The points from the convex set found by the faster Graham scan.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @return Whether the convex set is the same.
+ */
+static bool check_chan_scan(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                            const size_t convex_point_cnt) {
+  return check_in_place_scan(chan_scan_in_place, points, point_cnt, convex_points, convex_point_cnt);
+}
+
+/**
+ * @brief Checks that the QuickHull algorithm finds the same convex hull as the faster Graham scan.
+ * @details The farthest point from each line must be exactly the farthest, or the convex hull isn't convex, which
+ * near-collinear inputs test the most.
+ * @param[in] points The points to scan.
+ * @param point_cnt The number of points to scan.
+ * @param[in] convex_points The points from the convex set found by the faster Graham scan.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @return Whether the convex set is the same.
+ */
+static bool check_quick_hull(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                             const size_t convex_point_cnt) {
+  return check_in_place_scan(quick_hull_in_place, points, point_cnt, convex_points, convex_point_cnt);
+}
+
+/**
+ * @brief Checks that the in-place scans find the same convex hull as the monotone chain for degenerate inputs.
+ * @details The inputs are the first two points in both orders, a single point, and a repeated point, whose convex sets
+ * must still be free of duplicates and start from the anchor point.
+ * @param[in] points The points to take the inputs from. This must have at least two points.
+ * @param point_cnt The number of points to take the inputs from.
+ * @param[in] convex_points Unused, since every input has its own convex set.
+ * @param convex_point_cnt Unused, since every input has its own convex set.
+ * @return Whether every convex set is the same.
+ */
+static bool check_degenerate_inputs(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                                    const size_t convex_point_cnt) {
+  (void)point_cnt;
+  (void)convex_points;
+  (void)convex_point_cnt;
+
+  static const InPlaceScan scans[DEGENERATE_SCAN_COUNT] = {slow_scan_in_place, fast_scan_in_place, chan_scan_in_place,
+                                                           quick_hull_in_place};
+  const Point inputs[DEGENERATE_INPUT_COUNT][MAX_DEGENERATE_POINT_COUNT] = {
+      {points[0]},
+      {points[0], points[1]},
+      {points[1], points[0]},
+      {points[0], points[0]},
+      {points[0], points[0], points[0]},
+  };
+  const size_t input_point_cnts[DEGENERATE_INPUT_COUNT] = {1, 2, 2, 2, 3};
+  bool is_passed = true;
+
+  for (size_t i = 0; i < DEGENERATE_INPUT_COUNT && is_passed; i++) {
+    Point scanned_points[MAX_DEGENERATE_POINT_COUNT];
+    Point expected_points[MAX_DEGENERATE_POINT_COUNT];
+    size_t expected_point_cnt = 0;
+
+    memcpy(scanned_points, inputs[i], sizeof(scanned_points));
+    monotone_chain_scan_into(scanned_points, input_point_cnts[i], expected_points, MAX_DEGENERATE_POINT_COUNT,
+                             &expected_point_cnt);
+
+    for (size_t j = 0; j < DEGENERATE_SCAN_COUNT && is_passed; j++) {
+      is_passed = check_in_place_scan(scans[j], inputs[i], input_point_cnts[i], expected_points, expected_point_cnt);
+    }
+  }
+
+  return is_passed;
+}
+
+/**
+ * @brief Checks that `batch_scan` finds the same convex hull for every group as the faster Graham scan.
+ * @details The points are split into groups of `MIN_CHECK_GROUP_SIZE` points and up, growing by one point per group
+ * and starting over every `CHECK_GROUP_SIZE_COUNT` groups. The last group takes any points too few to be a group.
+ * @param[in] points The points to group.
+ * @param point_cnt The number of points to group.
+ * @param[in] convex_points Unused, since every group has its own convex set.
+ * @param convex_point_cnt Unused, since every group has its own convex set.
+ * @return Whether every group's convex set is the same.
+ */
+static bool check_batch_scan(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                             const size_t convex_point_cnt) {
+  (void)convex_points;
+  (void)convex_point_cnt;
+
+  const size_t max_group_cnt = point_cnt / MIN_CHECK_GROUP_SIZE + 1;
+  const size_t max_group_size = 2 * MIN_CHECK_GROUP_SIZE + CHECK_GROUP_SIZE_COUNT;
+  size_t* const offsets = malloc((max_group_cnt + 1) * sizeof(size_t));
+  size_t* const convex_offsets = malloc((max_group_cnt + 1) * sizeof(size_t));
+  Point* const batch_points = malloc(point_cnt * sizeof(Point));
+  Point* const group_points = malloc(2 * max_group_size * sizeof(Point));
+  bool is_passed = offsets && convex_offsets && batch_points && group_points;
+  size_t group_cnt = 0;
+
+  for (size_t point_idx = 0; is_passed && point_idx < point_cnt; group_cnt++) {
+    const size_t remaining_point_cnt = point_cnt - point_idx;
+    size_t group_size = MIN_CHECK_GROUP_SIZE + group_cnt % CHECK_GROUP_SIZE_COUNT;
+
+    if (group_size + MIN_CHECK_GROUP_SIZE > remaining_point_cnt) {
+      group_size = remaining_point_cnt;
+    }
+
+    offsets[group_cnt] = point_idx;
+    point_idx += group_size;
+  }
+
+  if (is_passed) {
+    offsets[group_cnt] = point_cnt;
+    is_passed = batch_scan(points, offsets, group_cnt, batch_points, convex_offsets, parallel_thread_count);
+  }
+
+  for (size_t i = 0; is_passed && i < group_cnt; i++) {
+    const size_t group_size = offsets[i + 1] - offsets[i];
+    Point* const expected_points = &group_points[max_group_size];
+    size_t expected_point_cnt = 0;
+
+    memcpy(group_points, &points[offsets[i]], group_size * sizeof(Point));
+    fast_scan_into(group_points, group_size, expected_points, group_size, &expected_point_cnt);
+
+    is_passed = is_same_convex_set(&batch_points[convex_offsets[i]], convex_offsets[i + 1] - convex_offsets[i],
+                                   expected_points, expected_point_cnt);
+  }
+
+  free(offsets);
+  free(convex_offsets);
+  free(batch_points);
+  free(group_points);
+
+  return is_passed;
+}
+
+/**
+ * @brief Checks that an `IncrementalHull` of every point has the same convex hull as the faster Graham scan.
+ * @param[in] points The points to insert.
+ * @param point_cnt The number of points to insert.
+ * @param[in] convex_points The points from the expected convex set.
+ * @param convex_point_cnt The number of points from the expected convex set.
+ * @return Whether the convex sets are the same.
+ */
+static bool check_incremental_hull(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                                   const size_t convex_point_cnt) {
+  IncrementalHull hull;
+  bool is_passed = true;
+
+  create_incremental_hull(&hull);
+
+  for (size_t i = 0; is_passed && i < point_cnt; i++) {
+    is_passed = insert_incremental_hull_point(&hull, points[i]);
+  }
+
+  Point* const hull_points = malloc(convex_point_cnt * sizeof(Point));
+
+  if (is_passed && hull_points && get_incremental_hull_point_count(&hull) == convex_point_cnt) {
+    const size_t hull_point_cnt = copy_incremental_hull_points(&hull, hull_points);
+
+    is_passed = is_same_convex_set(hull_points, hull_point_cnt, convex_points, convex_point_cnt);
+  } else {
+    is_passed = false;
+  }
+
+  free(hull_points);
+  destroy_incremental_hull(&hull);
+
+  return is_passed;
+}
+
+/**
+ * @brief Checks that a `DynamicHull` has the same convex hull as the faster Graham scan after removing points.
+ * @details Every point is inserted, then every other point is removed, and the convex hull of the rest is compared.
+ * @param[in] points The points to insert.
+ * @param point_cnt The number of points to insert.
+ * @param[in] convex_points Unused, since the convex set of the remaining points is found separately.
+ * @param convex_point_cnt Unused, since the convex set of the remaining points is found separately.
+ * @return Whether the convex sets are the same.
+ */
+static bool check_dynamic_hull(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                               const size_t convex_point_cnt) {
+  (void)convex_points;
+  (void)convex_point_cnt;
+
+  const size_t kept_point_cnt = (point_cnt + 1) / 2;
+  Point* const kept_points = malloc(kept_point_cnt * sizeof(Point));
+  Point* const expected_points = malloc(kept_point_cnt * sizeof(Point));
+  Point* const hull_points = malloc(kept_point_cnt * sizeof(Point));
+  DynamicHull hull;
+  bool is_passed = kept_points && expected_points && hull_points;
+
+  create_dynamic_hull(&hull);
+
+  for (size_t i = 0; is_passed && i < point_cnt; i++) {
+    is_passed = insert_dynamic_hull_point(&hull, points[i]);
+  }
+
+  for (size_t i = 0; is_passed && i < point_cnt; i++) {
+    if (i % 2 == 0) {
+      kept_points[i / 2] = points[i];
+    } else {
+      is_passed = remove_dynamic_hull_point(&hull, points[i]);
+    }
+  }
+
+  if (is_passed) {
+    size_t expected_point_cnt = 0;
+
+    fast_scan_into(kept_points, kept_point_cnt, expected_points, kept_point_cnt, &expected_point_cnt);
+
+    is_passed = get_dynamic_hull_point_count(&hull) == expected_point_cnt &&
+                is_same_convex_set(hull_points, copy_dynamic_hull_points(&hull, hull_points), expected_points,
+                                   expected_point_cnt);
+  }
+
+  free(kept_points);
+  free(expected_points);
+  free(hull_points);
+  destroy_dynamic_hull(&hull);
+
+  return is_passed;
+}
+
+/**
+ * @brief Checks that a `SlidingHull` has the same convex hull as the faster Graham scan as its window slides.
+ * @details The points arrive one second apart into a window limited by count and another limited by time, both holding
+ * `1 / CHECK_WINDOW_COUNT` of the points. Both are compared every half of a window once they are full.
+ * @param[in] points The points to push.
+ * @param point_cnt The number of points to push.
+ * @param[in] convex_points Unused, since the convex set of every window is found separately.
+ * @param convex_point_cnt Unused, since the convex set of every window is found separately.
+ * @return Whether the convex sets are the same.
+ */
+static bool check_sliding_hull(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                               const size_t convex_point_cnt) {
+  (void)convex_points;
+  (void)convex_point_cnt;
+
+  const size_t window_point_cnt = point_cnt / CHECK_WINDOW_COUNT;
+  Point* const window_points = malloc(window_point_cnt * sizeof(Point));
+  Point* const expected_points = malloc(window_point_cnt * sizeof(Point));
+  Point* const hull_points = malloc(window_point_cnt * sizeof(Point));
+  SlidingHull hulls[2];
+  bool is_passed = window_points && expected_points && hull_points;
+
+  create_sliding_hull(&hulls[0], 0, window_point_cnt);
+  create_sliding_hull(&hulls[1], (double)window_point_cnt, 0);
+
+  for (size_t i = 0; is_passed && i < point_cnt; i++) {
+    const TimedPoint point = {(double)i, points[i]};
+
+    is_passed = push_sliding_hull_point(&hulls[0], point) && push_sliding_hull_point(&hulls[1], point);
+
+    if (!is_passed || i + 1 < window_point_cnt || (i + 1 - window_point_cnt) % (window_point_cnt / 2) != 0) {
+      continue;
+    }
+
+    size_t expected_point_cnt = 0;
+
+    memcpy(window_points, &points[i + 1 - window_point_cnt], window_point_cnt * sizeof(Point));
+    fast_scan_into(window_points, window_point_cnt, expected_points, window_point_cnt, &expected_point_cnt);
+
+    for (size_t j = 0; is_passed && j < 2; j++) {
+      is_passed = get_sliding_hull_point_count(&hulls[j]) == expected_point_cnt &&
+                  is_same_convex_set(hull_points, copy_sliding_hull_points(&hulls[j], hull_points), expected_points,
+                                     expected_point_cnt);
+    }
+  }
+
+  free(window_points);
+  free(expected_points);
+  free(hull_points);
+  destroy_sliding_hull(&hulls[0]);
+  destroy_sliding_hull(&hulls[1]);
+
+  return is_passed;
+}
+
+/**
+ * @brief Checks if a point is inside a convex set of at least three points by its orientation from every edge.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @param[in] point The point to check.
+ * @return Whether the point is inside the convex set or on its boundary.
+ */
+static bool is_inside_convex_set(const Point* const convex_points, const size_t convex_point_cnt,
+                                 const Point* const point) {
+  for (size_t i = 0; i < convex_point_cnt; i++) {
+    if (orientation(&convex_points[i], &convex_points[(i + 1) % convex_point_cnt], point) < 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Checks that a `HullQuery` of the convex hull found by the faster Graham scan contains every point.
+ * @details Every point must be inside the convex hull, and every vertex moved `CHECK_PROBE_OFFSET` of the way further
+ * from the vertices' center must be outside of it. The moved vertices are rounded, which can leave them inside a thin
+ * convex hull, so they are expected wherever every edge's orientation puts them instead. Both are checked one point at
+ * a time and as a batch.
+ * @param[in] points The points to check.
+ * @param point_cnt The number of points to check.
+ * @param[in] convex_points The points from the convex set.
+ * @param convex_point_cnt The number of points from the convex set.
+ * @return Whether every check agreed.
+ */
+static bool check_hull_query(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                             const size_t convex_point_cnt) {
+  Point* const probe_points = malloc(convex_point_cnt * sizeof(Point));
+  uint64_t* const is_inside_mask = malloc(HULL_QUERY_MASK_WORD_COUNT(point_cnt) * sizeof(uint64_t));
+  HullQuery query;
+  PointSoA soa_points;
+  Point center = {0, 0};
+
+  create_point_soa(&soa_points);
+
+  if (!probe_points || !is_inside_mask || !create_hull_query(&query, convex_points, convex_point_cnt)) {
+    free(probe_points);
+    free(is_inside_mask);
+
+    return false;
+  }
+
+  for (size_t i = 0; i < convex_point_cnt; i++) {
+    center.x += convex_points[i].x / (double)convex_point_cnt;
+    center.y += convex_points[i].y / (double)convex_point_cnt;
+  }
+
+  for (size_t i = 0; i < convex_point_cnt; i++) {
+    probe_points[i].x = convex_points[i].x + CHECK_PROBE_OFFSET * (convex_points[i].x - center.x);
+    probe_points[i].y = convex_points[i].y + CHECK_PROBE_OFFSET * (convex_points[i].y - center.y);
+  }
+
+  bool is_passed = copy_points_to_soa(&soa_points, points, point_cnt);
+
+  if (is_passed) {
+    find_points_inside_hull(&query, &soa_points, is_inside_mask);
+  }
+
+  for (size_t i = 0; is_passed && i < point_cnt; i++) {
+    const bool is_inside = is_inside_mask[i / HULL_QUERY_MASK_BITS] >> i % HULL_QUERY_MASK_BITS & 1;
+
+    is_passed = is_inside && is_point_inside_hull(&query, &points[i]);
+  }
+
+  is_passed = is_passed && copy_points_to_soa(&soa_points, probe_points, convex_point_cnt);
+
+  if (is_passed) {
+    find_points_inside_hull(&query, &soa_points, is_inside_mask);
+  }
+
+  for (size_t i = 0; is_passed && i < convex_point_cnt; i++) {
+    const bool is_inside = is_inside_mask[i / HULL_QUERY_MASK_BITS] >> i % HULL_QUERY_MASK_BITS & 1;
+
+    const bool is_expected_inside =
+        convex_point_cnt >= 3 && is_inside_convex_set(convex_points, convex_point_cnt, &probe_points[i]);
+
+    is_passed = is_inside == is_expected_inside && is_point_inside_hull(&query, &probe_points[i]) == is_expected_inside;
+  }
+
+  free(probe_points);
+  free(is_inside_mask);
+  destroy_point_soa(&soa_points);
+  destroy_hull_query(&query);
+
+  return is_passed;
+}
+
+/**
+ * @brief Checks that every supported instruction set gets the same results from the kernels as plain C.
+ * @details Every instruction set is selected with `set_instruction_set` in turn. The orientations of the points against
+ * a chord of the convex hull, their bounding box, their extreme points, and the points left by culling them from a
+ * structure of arrays are compared with the scalar kernels' results. The culled points must also have the same convex
+ * hull as the faster Graham scan. The instruction set in use before is selected again afterwards.
+ * @param[in] points The points to check.
+ * @param point_cnt The number of points to check.
+ * @param[in] convex_points The points from the expected convex set.
+ * @param convex_point_cnt The number of points from the expected convex set.
+ * @return Whether every instruction set agreed.
+ */
+static bool check_kernels(const Point* const points, const size_t point_cnt, const Point* const convex_points,
+                          const size_t convex_point_cnt) {
+  const InstructionSet default_instruction_set = get_instruction_set();
+  const InstructionSet supported_instruction_set = get_supported_instruction_set();
+  // the scalar kernels' results are kept in the first half, and every other instruction set's in the second half
+  signed char* const orientations = malloc(2 * point_cnt * sizeof(signed char));
+  Point* const culled_points = malloc(2 * point_cnt * sizeof(Point));
+  BoundingBox boxes[2];
+  size_t extreme_indexes[2][EXTREME_DIRECTION_COUNT];
+  size_t culled_point_cnts[2];
+  PointSoA soa_points;
+  bool is_passed = orientations && culled_points;
+
+  create_point_soa(&soa_points);
+
+  for (int i = SCALAR_INSTRUCTION_SET; is_passed && i <= (int)supported_instruction_set; i++) {
+    const size_t result_idx = i == SCALAR_INSTRUCTION_SET ? 0 : 1;
+
+    set_instruction_set((InstructionSet)i);
+
+    if (!copy_points_to_soa(&soa_points, points, point_cnt)) {
+      is_passed = false;
+
+      break;
+    }
+
+    batch_orientation(&soa_points, &convex_points[0], &convex_points[convex_point_cnt / 2],
+                      &orientations[result_idx * point_cnt]);
+    find_bounding_box(&soa_points, &boxes[result_idx]);
+    find_extreme_points(&soa_points, extreme_indexes[result_idx]);
+    culled_point_cnts[result_idx] = cull_interior_points_soa(&soa_points, OCTAGON_DIRECTION_COUNT);
+    copy_points_from_soa(&soa_points, &culled_points[result_idx * point_cnt]);
+
+    if (result_idx > 0) {
+      is_passed = memcmp(orientations, &orientations[point_cnt], point_cnt * sizeof(signed char)) == 0 &&
+                  boxes[0].min_x == boxes[1].min_x && boxes[0].min_y == boxes[1].min_y &&
+                  boxes[0].max_x == boxes[1].max_x && boxes[0].max_y == boxes[1].max_y &&
+                  memcmp(extreme_indexes[0], extreme_indexes[1], sizeof extreme_indexes[0]) == 0 &&
+                  is_same_convex_set(culled_points, culled_point_cnts[0], &culled_points[point_cnt],
+                                     culled_point_cnts[1]);
+    }
+  }
+
+  set_instruction_set(default_instruction_set);
+
+  if (is_passed) {
+    size_t culled_convex_point_cnt = 0;
+
+    fast_scan_into(culled_points, culled_point_cnts[0], &culled_points[point_cnt], point_cnt,
+                   &culled_convex_point_cnt);
+
+    is_passed = is_same_convex_set(&culled_points[point_cnt], culled_convex_point_cnt, convex_points,
+                                   convex_point_cnt);
+  }
+
+  free(orientations);
+  free(culled_points);
+  destroy_point_soa(&soa_points);
+
+  return is_passed;
+}
+
+/** @brief The number of checked library APIs. */
+#define CHECK_COUNT 10
+
+/** @brief The checked library APIs. */
+static const Check CHECKS[CHECK_COUNT] = {check_graham_scans,      check_chan_scan,        check_quick_hull,
+                                          check_degenerate_inputs, check_batch_scan,       check_incremental_hull,
+                                          check_dynamic_hull,      check_sliding_hull,     check_hull_query,
+                                          check_kernels};
+
+/** @brief The names of the checked library APIs, as printed in the results. */
+static const char* const CHECK_NAMES[CHECK_COUNT] = {"graham",      "chan",    "quick",   "degenerate", "batch",
+                                                     "incremental", "dynamic", "sliding", "query",      "kernels"};
+
+/**
+ * @brief Prints a phase's duration as a CSV field.
+ * @param duration The duration to print, or `MISSING_DURATION` to print an empty field.
+ */
+static void print_duration(const int64_t duration) {
+  if (duration != MISSING_DURATION) {
+    printf("%lld", (long long)duration);
+  }
+
+  printf(",");
+}
+
+/**
+ * @brief Parses a positive decimal count.
+ * @param[in] string The string to parse.
+ * @param[out] count The count parsed from the string.
+ * @return Whether the whole string was a positive count.
+ */
+static bool parse_count(const char* const string, size_t* const count) {
+  if (!isdigit((unsigned char)string[0])) {
+    return false;
+  }
+
+  char* end;
+  const unsigned long long parsed_count = strtoull(string, &end, 10);
+
+  if (*end != '\0' || parsed_count == 0) {
+    return false;
+  }
+
+  *count = (size_t)parsed_count;
+
+  return true;
+}
+
+/**
+ * @brief Runs every engine on every generated input multiple times, and prints the durations of every run as CSV.
+ * @param[out] input_points The array to generate the inputs into.
+ * @param[out] points The array to copy every input into before each run.
+ * @param[out] convex_points The array the engines write the points from the created convex sets to.
+ * @param max_point_cnt The number of points of the largest input.
+ * @param run_cnt The number of times each engine is run on each input.
+ * @param seed The seed of the inputs' generator.
+ * @return Whether every engine could be run.
+ */
+static bool run_benchmarks(Point* const input_points, Point* const points, Point* const convex_points,
+                           const size_t max_point_cnt, const size_t run_cnt, const uint64_t seed) {
+  printf("distribution,point_count,engine,run,anchor_ns,sort_ns,scan_ns,total_ns,convex_point_count\n");
+
+  bool is_run = true;
+
+  for (size_t point_cnt = 1000; point_cnt <= max_point_cnt; point_cnt *= 10) {
+    for (size_t i = 0; i < DISTRIBUTION_COUNT; i++) {
+      generate_points(input_points, point_cnt, (Distribution)i, seed);
+
+      for (size_t j = 0; j < ENGINE_COUNT; j++) {
+        if (ENGINES[j] == run_slow_scan && point_cnt > MAX_SLOW_POINT_COUNT) {
+          continue;
+        }
+
+        for (size_t run = 0; run < run_cnt; run++) {
+          memcpy(points, input_points, point_cnt * sizeof(Point));
+
+          PhaseDurations durations;
+          const size_t convex_point_cnt = ENGINES[j](points, point_cnt, convex_points, &durations);
+
+          if (convex_point_cnt == SIZE_MAX) {
+            fprintf(stderr, "%s ran out of memory on %zu points.\n", ENGINE_NAMES[j], point_cnt);
+
+            is_run = false;
+
+            break;
+          }
+
+          printf("%s,%zu,%s,%zu,", DISTRIBUTION_NAMES[i], point_cnt, ENGINE_NAMES[j], run + 1);
+          print_duration(durations.anchor);
+          print_duration(durations.sort);
+          print_duration(durations.scan);
+          printf("%lld,%zu\n", (long long)durations.total, convex_point_cnt);
+        }
+      }
+    }
+  }
+
+  return is_run;
+}
+
+/**
+ * @brief Checks every library API on every generated input, and prints the results as CSV.
+ * @details The Graham scans are checked against the monotone chain, and every other API against the faster Graham scan.
+ * @param[out] input_points The array to generate the inputs into.
+ * @param[out] points The array to scan every input in.
+ * @param[out] convex_points The array to write the points from the convex sets found by the faster Graham scan to.
+ * @param max_point_cnt The number of points of the largest input.
+ * @param seed The seed of the inputs' generator.
+ * @return Whether every check passed.
+ */
+static bool run_checks(Point* const input_points, Point* const points, Point* const convex_points,
+                       const size_t max_point_cnt, const uint64_t seed) {
+  printf("distribution,point_count,check,result\n");
+
+  bool is_passed = true;
+
+  for (size_t point_cnt = 1000; point_cnt <= max_point_cnt; point_cnt *= 10) {
+    for (size_t i = 0; i < DISTRIBUTION_COUNT; i++) {
+      size_t convex_point_cnt = 0;
+
+      generate_points(input_points, point_cnt, (Distribution)i, seed);
+      memcpy(points, input_points, point_cnt * sizeof(Point));
+      fast_scan_into(points, point_cnt, convex_points, point_cnt, &convex_point_cnt);
+
+      for (size_t j = 0; j < CHECK_COUNT; j++) {
+        const bool is_check_passed = CHECKS[j](input_points, point_cnt, convex_points, convex_point_cnt);
+
+        printf("%s,%zu,%s,%s\n", DISTRIBUTION_NAMES[i], point_cnt, CHECK_NAMES[j], is_check_passed ? "pass" : "fail");
+
+        is_passed = is_passed && is_check_passed;
+      }
+    }
+  }
+
+  return is_passed;
+}
+
+/**
+ * @brief The entry point of the convex hull benchmark program.
+ * @details This generates inputs of every size from `10^3` up to the largest size for every distribution, runs every
+ * engine on each of them multiple times, and prints the durations of every run as CSV. With `--check`, every library
+ * API is checked on each input instead.
+ * @param argc The number of command-line arguments.
+ * @param[in] argv The command-line arguments: optionally `--max-size=<exponent>`, `--runs=<count>`, `--seed=<seed>`,
+ * `--threads=<count>`, and `--check`.
+ * @return The program's resulting exit code.
+ */
+int main(const int argc, char* argv[]) {
+  size_t max_size_exponent = DEFAULT_MAX_SIZE_EXPONENT;
+  size_t run_cnt = DEFAULT_RUN_COUNT;
+  size_t seed = DEFAULT_SEED;
+  bool is_checked = false;
+
+  parallel_thread_count = get_processor_count();
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--check") == 0) {
+      is_checked = true;
+
+      continue;
+    }
+
+    const bool is_parsed =
+        (strncmp(argv[i], "--max-size=", 11) == 0 && parse_count(&argv[i][11], &max_size_exponent) &&
+         max_size_exponent >= MIN_SIZE_EXPONENT && max_size_exponent <= MAX_SIZE_EXPONENT) ||
+        (strncmp(argv[i], "--runs=", 7) == 0 && parse_count(&argv[i][7], &run_cnt)) ||
+        (strncmp(argv[i], "--seed=", 7) == 0 && parse_count(&argv[i][7], &seed)) ||
+        (strncmp(argv[i], "--threads=", 10) == 0 && parse_count(&argv[i][10], &parallel_thread_count));
+
+    if (!is_parsed) {
+      printf("Usage: %s [--max-size=<3-8>] [--runs=<count>] [--seed=<seed>] [--threads=<count>] [--check]\n",
+             argv[0]);
+
+      return 1;
+    }
+  }
+
+  size_t max_point_cnt = 1;
+
+  for (size_t i = 0; i < max_size_exponent; i++) {
+    max_point_cnt *= 10;
+  }
+
+  Point* const input_points = malloc(max_point_cnt * sizeof(Point));
+  Point* const points = malloc(max_point_cnt * sizeof(Point));
+  Point* const convex_points = malloc(max_point_cnt * sizeof(Point));
+
+  if (!input_points || !points || !convex_points) {
+    printf("Not enough memory for %zu points.\n", max_point_cnt);
+
+    free(input_points);
+    free(points);
+    free(convex_points);
+
+    return 1;
+  }
+
+  const bool is_done = is_checked ? run_checks(input_points, points, convex_points, max_point_cnt, seed)
+                                  : run_benchmarks(input_points, points, convex_points, max_point_cnt, run_cnt, seed);
+
+  free(input_points);
+  free(points);
+  free(convex_points);
+
+  return is_done ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "convex_hull/point_buffer.h"
+#include "io.h"
+
+/**
+ * @brief The entry point of the point file converter program.
+ * @details The input file can be either a text or a binary point file. The output file's format is chosen by its
+ * extension: a binary point file if it ends with `BINARY_FILE_EXTENSION`, or a text file otherwise.
+ * @param argc The number of command-line arguments.
+ * @param[in] argv The command-line arguments: the input file name, the output file name, and optionally `--columnar`.
+ * @return The program's resulting exit code.
+ */
+int main(const int argc, char* argv[]) {
+  if (argc < 3 || argc > 4 || (argc == 4 && strcmp(argv[3], "--columnar") != 0)) {
+    printf("Usage: %s <input file> <output file> [--columnar]\n", argv[0]);
+
+    return 1;
+  }
+
+  const char* const in_file_name = argv[1];
+  const char* const out_file_name = argv[2];
+  const PointFileLayout layout = argc == 4 ? COLUMNAR_LAYOUT : INTERLEAVED_LAYOUT;
+
+  PointBuffer points;
+
+  create_point_buffer(&points);
+
+  if (!parse_points_from_file(in_file_name, &points)) {
+    destroy_point_buffer(&points);
+
+    return 1;
+  }
+
+  const bool is_written = is_binary_file_name(out_file_name)
+                            ? write_binary_file(out_file_name, points.elements, points.count, layout)
+                            : write_output_file(out_file_name, points.elements, points.count);
+
+  destroy_point_buffer(&points);
+
+  return is_written ? 0 : 1;
+}
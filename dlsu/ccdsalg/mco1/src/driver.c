@@ -0,0 +1,258 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "driver.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#include "convex_hull/approximate_hull.h"
+#include "convex_hull/chan_scan.h"
+#include "convex_hull/culling.h"
+#include "convex_hull/quick_hull.h"
+#include "convex_hull/rotating_calipers.h"
+#include "io.h"
+
+/**
+ * @brief Finds the convex hull of an array of points with the options set by the command-line arguments.
+ * @param[in,out] points The points to find the convex hull of. The convex hull is moved to the start of the array.
+ * @param point_cnt The number of points to use.
+ * @param[in] options The options set by the command-line arguments.
+ * @param graham_scan The Graham scan of the Graham engine.
+ * @param[in,out] error_bound The distance the approximate engine's convex hull may be off by, which is added to, since
+ * the errors of successive chunks add up. It is left as is by the exact engines.
+ * @return The number of points from the convex set.
+ */
+static size_t find_convex_hull(Point* const points, size_t point_cnt, const ScanOptions* const options,
+                               const InPlaceScan graham_scan, double* const error_bound) {
+  if (options->cull_direction_count > 0) {
+    point_cnt = cull_interior_points(points, point_cnt, options->cull_direction_count);
+  }
+
+  if (options->engine == QUICK_ENGINE) {
+    return parallel_quick_hull_in_place(points, point_cnt, options->thread_count);
+  }
+
+  // the approximation already takes linear time, so it isn't split between the threads
+  if (options->engine == APPROXIMATE_ENGINE) {
+    double chunk_error_bound;
+
+    point_cnt = approximate_hull_in_place_with_strips(points, point_cnt, options->strip_count, &chunk_error_bound);
+    *error_bound += chunk_error_bound;
+
+    return point_cnt;
+  }
+
+  const InPlaceScan scan = options->engine == CHAN_ENGINE ? chan_scan_in_place : graham_scan;
+
+  return parallel_scan_in_place(points, point_cnt, options->thread_count, scan);
+}
+
+/**
+ * @brief Finds the convex hull of the points in an input file, reading a chunk of points at a time.
+ * @details The convex hull found so far stays at the start of the point buffer, and every chunk is read right after
+ * it, so the next convex hull is found from both. The point buffer only ever holds a chunk and a convex hull.
+ * @param[in] in_file_name The name of the input file.
+ * @param[in] options The options set by the command-line arguments.
+ * @param graham_scan The Graham scan of the Graham engine.
+ * @param[in,out] points The buffer to read the chunks into. It contains the convex hull afterwards.
+ * @param[out] scan_clock_cnt The processor time spent finding convex hulls, without reading the file.
+ * @param[out] error_bound The distance the approximate engine's convex hull may be off by.
+ * @return Whether the input file was found and read.
+ */
+static bool scan_file_in_chunks(const char* const in_file_name, const ScanOptions* const options,
+                                const InPlaceScan graham_scan, PointBuffer* const points,
+                                clock_t* const scan_clock_cnt, double* const error_bound) {
+  PointStream stream;
+
+  if (!open_point_stream(in_file_name, &stream)) {
+    return false;
+  }
+
+  bool is_read = true;
+  size_t chunk_point_cnt;
+
+  points->count = 0;
+
+  do {
+    if (!reserve_points(points, points->count + options->stream_chunk_size)) {
+      printf("File %s has too many points.\n", in_file_name);
+
+      is_read = false;
+
+      break;
+    }
+
+    is_read = read_point_chunk(&stream, &points->elements[points->count], options->stream_chunk_size,
+                               &chunk_point_cnt);
+
+    if (is_read && chunk_point_cnt > 0) {
+      const clock_t start_clock = clock();
+
+      points->count = find_convex_hull(points->elements, points->count + chunk_point_cnt, options, graham_scan,
+                                       error_bound);
+      *scan_clock_cnt += clock() - start_clock;
+    }
+  } while (is_read && chunk_point_cnt > 0);
+
+  close_point_stream(&stream);
+
+  return is_read;
+}
+
+/**
+ * @brief Finds the convex hull of the points in an input file and writes it to an output file.
+ * @details A missing file name is prompted for, in which case the execution time, the approximate engine's error bound,
+ * and the convex hull's metrics are printed to the standard output. Otherwise, they are printed to the standard error,
+ * so they never mix with points written to the standard output.
+ * @param[in] in_file_name The name of the input file, or `NULL` to prompt for it.
+ * @param[in] out_file_name The name of the output file, or `NULL` to prompt for it.
+ * @param[in] options The options set by the command-line arguments.
+ * @param graham_scan The Graham scan of the Graham engine.
+ * @param[in,out] points The buffer to parse the points into. Reusing it across files stops allocating once it is large
+ * enough.
+ * @return Whether the input file was parsed and the output file was written to.
+ */
+static bool scan_file(const char* in_file_name, const char* out_file_name, const ScanOptions* const options,
+                      const InPlaceScan graham_scan, PointBuffer* const points) {
+  const bool is_interactive = !in_file_name;
+  StringBuffer in_file_name_input;
+
+  if (is_interactive) {
+    printf("Input filename: ");
+
+    get_string_input(in_file_name_input);
+
+    in_file_name = in_file_name_input;
+  }
+
+  clock_t scan_clock_cnt = 0;
+  double error_bound = 0;
+
+  if (options->stream_chunk_size > 0) {
+    if (!scan_file_in_chunks(in_file_name, options, graham_scan, points, &scan_clock_cnt, &error_bound)) {
+      return false;
+    }
+  } else {
+    if (!parse_points_from_file_in_parallel(in_file_name, points, options->thread_count)) {
+      return false;
+    }
+
+    const clock_t start_clock = clock();
+
+    points->count = find_convex_hull(points->elements, points->count, options, graham_scan, &error_bound);
+    scan_clock_cnt = clock() - start_clock;
+  }
+
+  fprintf(is_interactive ? stdout : stderr, "Execution time: %lfms\n", (double)scan_clock_cnt / CLOCKS_PER_SEC * 1000);
+
+  if (options->engine == APPROXIMATE_ENGINE) {
+    fprintf(is_interactive ? stdout : stderr, "Error bound: %lf\n", error_bound);
+  }
+
+  if (options->is_measured) {
+    HullMetrics metrics;
+
+    measure_hull(points->elements, points->count, &metrics);
+    print_hull_metrics(is_interactive ? stdout : stderr, &metrics);
+  }
+
+  StringBuffer out_file_name_input;
+
+  if (!out_file_name) {
+    printf("Output filename: ");
+
+    get_string_input(out_file_name_input);
+
+    out_file_name = out_file_name_input;
+  }
+
+  return write_output_file(out_file_name, points->elements, points->count);
+}
+
+/**
+ * @brief Finds the convex hulls of every pair of input and output files listed in a manifest file.
+ * @details The same point buffer is reused for every file, so it is only grown by files larger than any before them. A
+ * file that can't be scanned is skipped.
+ * @param[in] manifest_file_name The name of the manifest file, or `STANDARD_STREAM_NAME` to read the standard input.
+ * @param[in] options The options set by the command-line arguments.
+ * @param graham_scan The Graham scan of the Graham engine.
+ * @param[in,out] points The buffer to parse the points into.
+ * @return Whether every file listed in the manifest file was scanned.
+ */
+static bool scan_manifest_files(const char* const manifest_file_name, const ScanOptions* const options,
+                                const InPlaceScan graham_scan, PointBuffer* const points) {
+  const bool is_standard_input = is_standard_stream_name(manifest_file_name);
+  FILE* const manifest_file = is_standard_input ? stdin : fopen(manifest_file_name, "r");
+
+  if (!manifest_file) {
+    printf("File %s not found.\n", manifest_file_name);
+
+    return false;
+  }
+
+  bool is_scanned = true;
+  ManifestLine line;
+  char* in_file_name;
+  char* out_file_name;
+
+  while (read_manifest_entry(manifest_file, line, &in_file_name, &out_file_name)) {
+    if (!in_file_name) {
+      printf("File %s has a malformed line.\n", manifest_file_name);
+
+      is_scanned = false;
+    } else if (!scan_file(in_file_name, out_file_name, options, graham_scan, points)) {
+      is_scanned = false;
+    }
+  }
+
+  if (!is_standard_input) {
+    fclose(manifest_file);
+  }
+
+  return is_scanned;
+}
+
+/**
+ * @brief Runs the convex hull calculator program with a Graham scan.
+ * @details The command-line arguments choose between the Graham engine and the others, so the programs only differ by
+ * the Graham scan they pass.
+ * @param arg_cnt The number of command-line arguments.
+ * @param[in] args The command-line arguments.
+ * @param graham_scan The Graham scan of the Graham engine.
+ * @return The program's resulting exit code.
+ */
+int run_convex_hull_program(const int arg_cnt, char* const args[], const InPlaceScan graham_scan) {
+  ScanOptions options;
+
+  if (!parse_arguments(arg_cnt, args, &options)) {
+    return 1;
+  }
+
+  PointBuffer points;
+
+  create_point_buffer(&points);
+
+  const bool is_scanned = options.manifest_file_name
+                            ? scan_manifest_files(options.manifest_file_name, &options, graham_scan, &points)
+                            : scan_file(options.in_file_name, options.out_file_name, &options, graham_scan, &points);
+
+  destroy_point_buffer(&points);
+
+  return is_scanned ? 0 : 1;
+}
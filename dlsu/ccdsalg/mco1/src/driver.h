@@ -0,0 +1,43 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file driver.h
+ * @brief The public APIs of the driver shared by the convex hull calculator programs.
+ * @author Raphael Panaligan
+ * @author Jek Degullado
+ * @copyright GNU AGPLv3
+ */
+
+#ifndef DRIVER_H_
+#define DRIVER_H_
+
+#include "convex_hull/parallel_scan.h"
+
+/**
+ * @brief Runs the convex hull calculator program with a Graham scan.
+ * @details The command-line arguments choose between the Graham engine and the others, so the programs only differ by
+ * the Graham scan they pass.
+ * @param argument_count The number of command-line arguments.
+ * @param[in] arguments The command-line arguments.
+ * @param graham_scan The Graham scan of the Graham engine.
+ * @return The program's resulting exit code.
+ */
+int run_convex_hull_program(int argument_count, char* const arguments[], InPlaceScan graham_scan);
+
+#endif  // DRIVER_H_
@@ -16,12 +16,30 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include "io.h"
 
 #include <ctype.h>
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include "convex_hull/culling.h"
+#include "convex_hull/parallel_scan.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 /**
  * @brief Gets a string typed input from the user.
  * @param[out] str The input received from the user.
@@ -31,87 +49,1667 @@ void get_string_input(StringBuffer str) {
 
   fgets(str, BUFFER_SIZE, stdin);
 
-  size_t last_idx = strlen(str) - 1;
+  size_t str_len = strlen(str);
 
-  if (str[last_idx] != '\n') {
+  if (str_len == 0 || str[str_len - 1] != '\n') {
     int excess_char;
 
     while ((excess_char = getchar()) != '\n' && excess_char != EOF);
   }
 
-  while (last_idx >= 0 && isspace(str[last_idx])) {
-    str[last_idx--] = '\0';
+  while (str_len > 0 && isspace((unsigned char)str[str_len - 1])) {
+    str[--str_len] = '\0';
   }
 }
 
 /**
- * @brief Parses an input file containing the data of a list of points.
- * @details This assumes that the input file follows the format prescribed by the specifications.
- * @param[in] in_file_name The name of the file to parse.
- * @param[out] points The points parsed from the input file.
- * @param[out] point_cnt The number of points parsed from the input file.
- * @return Whether the input file was found and parsed.
+ * @brief Parses a positive decimal count.
+ * @param[in] string The string to parse.
+ * @param[out] count The count parsed from the string.
+ * @return Whether the whole string was a positive count.
  */
-bool parse_points_from_file(const StringBuffer in_file_name, Point* const points, size_t* const point_cnt) {
-  FILE* in_file = fopen(in_file_name, "r");
+static bool parse_count(const char* const string, size_t* const count) {
+  if (!isdigit((unsigned char)string[0])) {
+    return false;
+  }
 
-  if (!in_file) {
-    printf("File %s not found.\n", in_file_name);
+  char* end;
+  const unsigned long parsed_count = strtoul(string, &end, 10);
+
+  if (*end != '\0' || parsed_count == 0) {
+    return false;
+  }
+
+  *count = parsed_count;
+
+  return true;
+}
+
+/**
+ * @brief Parses the command-line arguments of the Graham scan implementations.
+ * @details `--cull` enables the interior point culling pre-pass with eight directions, and `--cull=4` enables it with
+ * four directions. `--threads=<count>` parses and scans with up to that many threads, and `--threads` with one thread
+ * per processor. Without it, a single thread is used. `--engine=chan` finds the convex hull with Chan's algorithm and
+ * `--engine=quick` with the QuickHull algorithm, instead of the program's own Graham scan, which `--engine=graham`
+ * selects. `--engine=approximate` finds an approximate convex hull with the Bentley-Faust-Preparata algorithm, which
+ * splits the points into `--strips=<count>` strips, or `DEFAULT_APPROXIMATE_STRIP_COUNT` strips without it. `--metrics`
+ * prints the diameter, the width, and the smallest enclosing rectangles of the convex hull.
+ * `--stream=<count>` reads the input file that many points at a time, keeping only the convex hull found so far in
+ * between, and `--stream` reads `DEFAULT_STREAM_CHUNK_SIZE` points at a time. An input and an output file name can be
+ * given to skip the prompts, or `--manifest=<file>` to process every pair of file names listed in the manifest. This
+ * prints the program's usage if an argument is not recognized.
+ * @param arg_cnt The number of command-line arguments.
+ * @param[in] args The command-line arguments.
+ * @param[out] options The options set by the command-line arguments.
+ * @return Whether every argument was recognized.
+ */
+bool parse_arguments(const int arg_cnt, char* const args[], ScanOptions* const options) {
+  options->cull_direction_count = 0;
+  options->engine = GRAHAM_ENGINE;
+  options->strip_count = DEFAULT_APPROXIMATE_STRIP_COUNT;
+  options->thread_count = 1;
+  options->is_measured = false;
+  options->stream_chunk_size = 0;
+  options->in_file_name = NULL;
+  options->out_file_name = NULL;
+  options->manifest_file_name = NULL;
+
+  bool is_recognized = true;
+
+  for (int i = 1; i < arg_cnt && is_recognized; i++) {
+    if (strcmp(args[i], "--cull") == 0) {
+      options->cull_direction_count = OCTAGON_DIRECTION_COUNT;
+    } else if (strcmp(args[i], "--cull=4") == 0) {
+      options->cull_direction_count = QUADRILATERAL_DIRECTION_COUNT;
+    } else if (strcmp(args[i], "--engine=graham") == 0) {
+      options->engine = GRAHAM_ENGINE;
+    } else if (strcmp(args[i], "--engine=chan") == 0) {
+      options->engine = CHAN_ENGINE;
+    } else if (strcmp(args[i], "--engine=quick") == 0) {
+      options->engine = QUICK_ENGINE;
+    } else if (strcmp(args[i], "--engine=approximate") == 0) {
+      options->engine = APPROXIMATE_ENGINE;
+    } else if (strncmp(args[i], "--strips=", 9) == 0) {
+      is_recognized = parse_count(&args[i][9], &options->strip_count);
+    } else if (strcmp(args[i], "--threads") == 0) {
+      options->thread_count = get_processor_count();
+    } else if (strncmp(args[i], "--threads=", 10) == 0) {
+      is_recognized = parse_count(&args[i][10], &options->thread_count);
+    } else if (strcmp(args[i], "--stream") == 0) {
+      options->stream_chunk_size = DEFAULT_STREAM_CHUNK_SIZE;
+    } else if (strncmp(args[i], "--stream=", 9) == 0) {
+      is_recognized = parse_count(&args[i][9], &options->stream_chunk_size);
+    } else if (strcmp(args[i], "--metrics") == 0) {
+      options->is_measured = true;
+    } else if (strncmp(args[i], "--manifest=", 11) == 0 && args[i][11] != '\0') {
+      options->manifest_file_name = &args[i][11];
+    } else if (strncmp(args[i], "--", 2) == 0) {
+      is_recognized = false;
+    } else if (!options->in_file_name) {
+      options->in_file_name = args[i];
+    } else if (!options->out_file_name) {
+      options->out_file_name = args[i];
+    } else {
+      is_recognized = false;
+    }
+  }
+
+  // the file names are either both given or both prompted for, and a manifest replaces them
+  if (!is_recognized || (options->in_file_name && !options->out_file_name) ||
+      (options->in_file_name && options->manifest_file_name)) {
+    printf("Usage: %s [--cull | --cull=4] [--engine=<graham | chan | quick | approximate>] [--strips=<count>] "
+           "[--threads | --threads=<count>] [--stream | --stream=<count>] [--metrics] "
+           "[<input file> <output file> | --manifest=<file>]\n",
+           args[0]);
+
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Reads the next entry of a manifest file.
+ * @details Every line of a manifest file contains an input file name and an output file name, separated by whitespace.
+ * Blank lines are skipped.
+ * @param[in,out] manifest_file The manifest file to read from.
+ * @param[out] line The line of the entry. The file names point into it.
+ * @param[out] in_file_name The input file name of the entry, or `NULL` if the line is malformed.
+ * @param[out] out_file_name The output file name of the entry, or `NULL` if the line is malformed.
+ * @return Whether an entry was read, or `false` at the end of the manifest file.
+ */
+bool read_manifest_entry(FILE* const manifest_file, ManifestLine line, char** const in_file_name,
+                         char** const out_file_name) {
+  while (fgets(line, MANIFEST_LINE_SIZE + 1, manifest_file)) {
+    const size_t line_len = strlen(line);
+    const bool is_truncated = line_len == MANIFEST_LINE_SIZE && line[line_len - 1] != '\n' && !feof(manifest_file);
+
+    if (is_truncated) {
+      int next_char;
+
+      do {
+        next_char = fgetc(manifest_file);
+      } while (next_char != '\n' && next_char != EOF);
+    }
+
+    const char* const delimiters = " \t\r\n";
+
+    *in_file_name = strtok(line, delimiters);
+
+    if (!*in_file_name) {
+      continue;
+    }
+
+    *out_file_name = strtok(NULL, delimiters);
+
+    if (is_truncated || !*out_file_name || strtok(NULL, delimiters)) {
+      *in_file_name = NULL;
+      *out_file_name = NULL;
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Checks if a file name refers to the standard input or output.
+ * @param[in] file_name The file name to check.
+ * @return Whether the file name is `STANDARD_STREAM_NAME`.
+ */
+bool is_standard_stream_name(const char* const file_name) {
+  return strcmp(file_name, STANDARD_STREAM_NAME) == 0;
+}
+
+/** @brief The number of significant decimal digits that always fit into a 64-bit unsigned integer. */
+#define MAX_EXACT_DIGIT_COUNT 19
+
+/** @brief The largest integer that a double can represent exactly (`2^53`). */
+#define MAX_EXACT_DOUBLE_INTEGER 9007199254740992ULL
+
+/** @brief The largest power of ten that a double can represent exactly. */
+#define MAX_EXACT_POWER_OF_TEN 22
+
+/** @brief The smallest number of bytes a thread will be given to parse. */
+#define MIN_PARSE_CHUNK_SIZE (1 << 20)
+
+/** @brief The powers of ten that a double can represent exactly. */
+static const double EXACT_POWERS_OF_TEN[MAX_EXACT_POWER_OF_TEN + 1] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/**
+ * @brief Skips the whitespace characters at the start of a range of characters.
+ * @param[in] cursor The start of the range.
+ * @param[in] end The end of the range.
+ * @return A pointer to the first non-whitespace character, or `end` if there is none.
+ */
+static const char* skip_whitespace(const char* cursor, const char* const end) {
+  while (cursor < end && isspace((unsigned char)*cursor)) {
+    cursor++;
+  }
+
+  return cursor;
+}
+
+/**
+ * @brief Checks if a character is a decimal digit.
+ * @param chr The character to check.
+ * @return Whether the character is between `0` and `9`.
+ */
+static bool is_digit(const char chr) { return chr >= '0' && chr <= '9'; }
+
+/**
+ * @brief Parses the point count at the start of a text file.
+ * @details A count with too many digits for a 64-bit integer is rejected instead of silently wrapping around.
+ * @param[in] cursor The start of the point count.
+ * @param[in] end The end of the text.
+ * @param[out] point_cnt The parsed point count.
+ * @return The end of the point count, or `NULL` if it doesn't fit into a 64-bit integer.
+ */
+static const char* parse_point_count(const char* cursor, const char* const end, uint64_t* const point_cnt) {
+  uint64_t count = 0;
+
+  for (; cursor < end && is_digit(*cursor); cursor++) {
+    const uint64_t digit = (uint64_t)(*cursor - '0');
+
+    if (count > (UINT64_MAX - digit) / 10) {
+      return NULL;
+    }
+
+    count = count * 10 + digit;
+  }
+
+  *point_cnt = count;
+
+  return cursor;
+}
+
+/**
+ * @brief Parses a decimal number at the start of a range of characters without copying it.
+ * @details This accumulates up to `MAX_EXACT_DIGIT_COUNT` significant digits into an integer and tracks the decimal
+ * exponent separately. When both the integer and the power of ten are exact doubles, a single multiplication or
+ * division gives the correctly rounded result. Otherwise, this falls back to `strtod` on a copy of the number.
+ * @param[in] cursor The start of the range.
+ * @param[in] end The end of the range.
+ * @param[out] value The number parsed from the range.
+ * @return A pointer to the character after the number, or `NULL` if the range doesn't start with a number.
+ */
+static const char* parse_decimal(const char* cursor, const char* const end, double* const value) {
+  const char* const start = cursor;
+  bool is_negative = false;
+
+  if (cursor < end && (*cursor == '-' || *cursor == '+')) {
+    is_negative = *cursor == '-';
+
+    cursor++;
+  }
+
+  uint64_t mantissa = 0;
+  int digit_cnt = 0;
+  int exponent = 0;
+  bool has_digits = false;
+  bool is_exact = true;
+
+  for (; cursor < end && is_digit(*cursor); cursor++) {
+    has_digits = true;
+
+    if (digit_cnt < MAX_EXACT_DIGIT_COUNT) {
+      mantissa = mantissa * 10 + (uint64_t)(*cursor - '0');
+
+      if (mantissa != 0) {
+        digit_cnt++;
+      }
+    } else {
+      exponent++;
+      is_exact = is_exact && *cursor == '0';
+    }
+  }
+
+  if (cursor < end && *cursor == '.') {
+    for (cursor++; cursor < end && is_digit(*cursor); cursor++) {
+      has_digits = true;
+
+      if (digit_cnt < MAX_EXACT_DIGIT_COUNT) {
+        mantissa = mantissa * 10 + (uint64_t)(*cursor - '0');
+        exponent--;
+
+        if (mantissa != 0) {
+          digit_cnt++;
+        }
+      } else {
+        is_exact = is_exact && *cursor == '0';
+      }
+    }
+  }
+
+  if (!has_digits) {
+    return NULL;
+  }
+
+  if (cursor < end && (*cursor == 'e' || *cursor == 'E')) {
+    const char* exponent_cursor = cursor + 1;
+    bool is_exponent_negative = false;
+
+    if (exponent_cursor < end && (*exponent_cursor == '-' || *exponent_cursor == '+')) {
+      is_exponent_negative = *exponent_cursor == '-';
+
+      exponent_cursor++;
+    }
+
+    if (exponent_cursor < end && is_digit(*exponent_cursor)) {
+      int explicit_exponent = 0;
+
+      for (; exponent_cursor < end && is_digit(*exponent_cursor); exponent_cursor++) {
+        if (explicit_exponent < 100000) {
+          explicit_exponent = explicit_exponent * 10 + (*exponent_cursor - '0');
+        }
+      }
+
+      exponent += is_exponent_negative ? -explicit_exponent : explicit_exponent;
+      cursor = exponent_cursor;
+    }
+  }
+
+  if (is_exact && mantissa <= MAX_EXACT_DOUBLE_INTEGER && exponent >= -MAX_EXACT_POWER_OF_TEN &&
+      exponent <= MAX_EXACT_POWER_OF_TEN) {
+    const double magnitude = exponent < 0 ? (double)mantissa / EXACT_POWERS_OF_TEN[-exponent]
+                                          : (double)mantissa * EXACT_POWERS_OF_TEN[exponent];
+
+    *value = is_negative ? -magnitude : magnitude;
+
+    return cursor;
+  }
+
+  const size_t number_len = (size_t)(cursor - start);
+  char short_number[64];
+  char* const number = number_len < sizeof short_number ? short_number : malloc(number_len + 1);
+
+  if (!number) {
+    return NULL;
+  }
+
+  memcpy(number, start, number_len);
+  number[number_len] = '\0';
+
+  *value = strtod(number, NULL);
+
+  if (number != short_number) {
+    free(number);
+  }
+
+  return cursor;
+}
+
+/**
+ * @brief Parses the points within a range of characters.
+ * @details Each point is a pair of whitespace separated decimal numbers. Lines can be of any length.
+ * @param[in] cursor The start of the range.
+ * @param[in] end The end of the range.
+ * @param max_point_cnt The maximum number of points to parse, which `points` must be able to contain.
+ * @param[out] points The array to write the parsed points to.
+ * @param[out] point_cnt The number of points parsed.
+ * @return A pointer to the character after the last parsed point, or `NULL` if the range didn't only contain points.
+ */
+static const char* parse_points(const char* cursor, const char* const end, const size_t max_point_cnt,
+                                Point* const points, size_t* const point_cnt) {
+  for (*point_cnt = 0; *point_cnt < max_point_cnt; (*point_cnt)++) {
+    cursor = skip_whitespace(cursor, end);
+
+    if (cursor == end) {
+      return cursor;
+    }
+
+    Point* const point = &points[*point_cnt];
+
+    cursor = parse_decimal(cursor, end, &point->x);
+
+    if (!cursor) {
+      return NULL;
+    }
+
+    cursor = parse_decimal(skip_whitespace(cursor, end), end, &point->y);
+
+    if (!cursor) {
+      return NULL;
+    }
+  }
+
+  return cursor;
+}
+
+/**
+ * @brief Counts the points within a range of characters without parsing them.
+ * @details Every whitespace separated word is counted as a number, and every two numbers as a point, so a range with an
+ * odd number of numbers still counts its last, incomplete point.
+ * @param[in] cursor The start of the range.
+ * @param[in] end The end of the range.
+ * @return The number of points within the range.
+ */
+static size_t count_points(const char* cursor, const char* const end) {
+  size_t number_cnt = 0;
+
+  for (cursor = skip_whitespace(cursor, end); cursor < end; cursor = skip_whitespace(cursor, end)) {
+    number_cnt++;
+
+    while (cursor < end && !isspace((unsigned char)*cursor)) {
+      cursor++;
+    }
+  }
+
+  return number_cnt / 2 + number_cnt % 2;
+}
+
+/**
+ * @brief Reads the next point of a timestamped point stream.
+ * @details Every line of the stream contains the time the point arrived at, in seconds, followed by the point's x and
+ * y-coordinates, separated by whitespace. Blank lines are skipped.
+ * @param[in,out] stream The stream to read from.
+ * @param[out] line The line of the point.
+ * @param[out] point The point parsed from the line.
+ * @param[out] is_parsed Whether the line was well-formed.
+ * @return Whether a line was read, or `false` at the end of the stream.
+ */
+bool read_timed_point(FILE* const stream, StreamLine line, TimedPoint* const point, bool* const is_parsed) {
+  while (fgets(line, STREAM_LINE_SIZE + 1, stream)) {
+    const size_t line_len = strlen(line);
+    const char* const end = &line[line_len];
+    const bool is_truncated = line_len == STREAM_LINE_SIZE && line[line_len - 1] != '\n' && !feof(stream);
+
+    if (is_truncated) {
+      int next_char;
+
+      do {
+        next_char = fgetc(stream);
+      } while (next_char != '\n' && next_char != EOF);
+    }
+
+    const char* cursor = skip_whitespace(line, end);
+
+    if (cursor == end) {
+      continue;
+    }
+
+    double* const values[] = {&point->time, &point->point.x, &point->point.y};
+
+    for (size_t i = 0; i < sizeof values / sizeof values[0] && cursor; i++) {
+      cursor = parse_decimal(skip_whitespace(cursor, end), end, values[i]);
+    }
+
+    *is_parsed = !is_truncated && cursor && skip_whitespace(cursor, end) == end;
+
+    return true;
+  }
+
+  return false;
+}
+
+/** @brief A range of a file's contents to be parsed by a thread. */
+typedef struct ParseTask {
+  /** @brief The start of the range. */
+  const char* begin;
+  /** @brief The end of the range. */
+  const char* end;
+  /** @brief The array to write the points parsed from the range to. */
+  Point* points;
+  /** @brief The number of points counted within the range, and then the number of points parsed from it. */
+  size_t point_count;
+  /** @brief The maximum number of points to parse, which is less than the number counted past the declared count. */
+  size_t max_point_count;
+  /** @brief Whether the range only contained points. */
+  bool is_parsed;
+  /** @brief The thread running the task. */
+  pthread_t thread;
+  /** @brief Whether the task is run by its own thread, instead of the calling thread. */
+  bool is_threaded;
+} ParseTask;
+
+/**
+ * @brief Counts the points within a parse task's range.
+ * @details This is the entry point of the counting threads.
+ * @param[in,out] task The parse task to run.
+ * @return Always `NULL`.
+ */
+static void* run_count_task(void* const task) {
+  ParseTask* const parse_task = task;
+
+  parse_task->point_count = count_points(parse_task->begin, parse_task->end);
+
+  return NULL;
+}
+
+/**
+ * @brief Parses the points within a parse task's range.
+ * @details This is the entry point of the parsing threads. Every point counted within the range must be parsed, unless
+ * the declared number of points ends within it, so numbers that aren't separated by whitespace are rejected instead of
+ * being written past the range's share of the point buffer.
+ * @param[in,out] task The parse task to run.
+ * @return Always `NULL`.
+ */
+static void* run_parse_task(void* const task) {
+  ParseTask* const parse_task = task;
+  const bool is_limited = parse_task->max_point_count < parse_task->point_count;
+  const char* const cursor = parse_points(parse_task->begin, parse_task->end, parse_task->max_point_count,
+                                          parse_task->points, &parse_task->point_count);
+
+  parse_task->is_parsed = cursor && (is_limited || skip_whitespace(cursor, parse_task->end) == parse_task->end);
+
+  return NULL;
+}
+
+/**
+ * @brief Runs every parse task on its own thread, or on the calling thread if a thread can't be created.
+ * @param[in,out] tasks The parse tasks to run.
+ * @param task_cnt The number of parse tasks.
+ * @param routine The routine to run every parse task with.
+ */
+static void run_parse_tasks(ParseTask* const tasks, const size_t task_cnt, void* (*const routine)(void*)) {
+  for (size_t i = 0; i < task_cnt; i++) {
+    ParseTask* const task = &tasks[i];
+
+    task->is_threaded = pthread_create(&task->thread, NULL, routine, task) == 0;
+
+    if (!task->is_threaded) {
+      routine(task);
+    }
+  }
+
+  for (size_t i = 0; i < task_cnt; i++) {
+    if (tasks[i].is_threaded) {
+      pthread_join(tasks[i].thread, NULL);
+    }
+  }
+}
+
+/**
+ * @brief Parses the points within a range of characters using multiple threads.
+ * @details The range is split into chunks that each end on a newline, so no line is split between two threads. The
+ * threads first count the points of their chunks, so every chunk's offset into the point buffer is known, and then
+ * parse their chunks directly into their own ranges of it. The point buffer must already contain `max_point_cnt`
+ * points, so it is never grown and no points are copied.
+ * @param[in] begin The start of the range.
+ * @param[in] end The end of the range.
+ * @param max_point_cnt The maximum number of points to parse.
+ * @param thread_cnt The number of threads to use.
+ * @param[in,out] points The points to write the parsed points to.
+ * @return Whether the range only contained points.
+ */
+static bool parse_points_in_parallel(const char* const begin, const char* const end, const size_t max_point_cnt,
+                                     const size_t thread_cnt, PointBuffer* const points) {
+  ParseTask* const tasks = malloc(thread_cnt * sizeof(ParseTask));
+
+  if (!tasks) {
+    return false;
+  }
+
+  const size_t chunk_size = (size_t)(end - begin) / thread_cnt;
+  const char* chunk_begin = begin;
+
+  for (size_t i = 0; i < thread_cnt; i++) {
+    const char* chunk_end = end;
+
+    if (i + 1 < thread_cnt && chunk_size < (size_t)(end - chunk_begin)) {
+      const char* const newline = memchr(chunk_begin + chunk_size, '\n', (size_t)(end - chunk_begin) - chunk_size);
+
+      chunk_end = newline ? newline + 1 : end;
+    }
+
+    tasks[i].begin = chunk_begin;
+    tasks[i].end = chunk_end;
+    chunk_begin = chunk_end;
+  }
+
+  run_parse_tasks(tasks, thread_cnt, run_count_task);
+
+  // the chunks past the declared number of points are left empty, like a single thread would stop parsing there
+  size_t point_offset = 0;
+
+  for (size_t i = 0; i < thread_cnt; i++) {
+    ParseTask* const task = &tasks[i];
+    const size_t remaining_point_cnt = max_point_cnt - point_offset;
+
+    task->points = &points->elements[point_offset];
+    task->max_point_count = task->point_count < remaining_point_cnt ? task->point_count : remaining_point_cnt;
+    task->is_parsed = false;
+    point_offset += task->max_point_count;
+  }
+
+  run_parse_tasks(tasks, thread_cnt, run_parse_task);
+
+  // every chunk is parsed into its own range, so a chunk with fewer points than counted leaves a gap to close
+  bool is_parsed = true;
+
+  points->count = 0;
+
+  for (size_t i = 0; i < thread_cnt && is_parsed; i++) {
+    const ParseTask* const task = &tasks[i];
+
+    is_parsed = task->is_parsed;
+
+    if (is_parsed && task->points != &points->elements[points->count]) {
+      memmove(&points->elements[points->count], task->points, task->point_count * sizeof(Point));
+    }
+
+    points->count += task->point_count;
+  }
+
+  free(tasks);
+
+  return is_parsed;
+}
+
+/** @brief A read-only view of a file's contents. */
+typedef struct FileView {
+  /** @brief The contents of the file. */
+  const char* contents;
+  /** @brief The number of bytes in the file. */
+  size_t size;
+  /** @brief Whether the contents are memory-mapped, instead of read into a heap array. */
+  bool is_mapped;
+} FileView;
+
+/**
+ * @brief Reads a stream's contents into a heap array until its end.
+ * @details This is used for streams that can't be memory-mapped, like the standard input.
+ * @param[in,out] stream The stream to read.
+ * @param[out] view The view of the stream's contents.
+ * @return Whether the whole stream was read.
+ */
+static bool read_stream(FILE* const stream, FileView* const view) {
+  char* contents = NULL;
+  size_t capacity = 0;
+  size_t read_size;
+
+  view->contents = NULL;
+  view->size = 0;
+  view->is_mapped = false;
+
+  do {
+    if (view->size == capacity) {
+      capacity = capacity == 0 ? MIN_PARSE_CHUNK_SIZE : capacity * 2;
+
+      char* const new_contents = realloc(contents, capacity);
+
+      if (!new_contents) {
+        free(contents);
+
+        return false;
+      }
+
+      contents = new_contents;
+    }
+
+    read_size = fread(&contents[view->size], 1, capacity - view->size, stream);
+    view->size += read_size;
+  } while (read_size > 0);
+
+  view->contents = contents;
+
+  return !ferror(stream);
+}
+
+/**
+ * @brief Maps a file's contents into memory.
+ * @details On POSIX systems, the file is memory-mapped with a sequential access hint, so its contents are never copied.
+ * Elsewhere, and for the standard input (`STANDARD_STREAM_NAME`), the whole file is read into a heap array.
+ * @param[in] file_name The name of the file to map.
+ * @param[out] view The view of the file's contents.
+ * @return Whether the file was found and mapped.
+ */
+static bool map_file(const char* const file_name, FileView* const view) {
+  view->contents = NULL;
+  view->size = 0;
+  view->is_mapped = false;
+
+  if (is_standard_stream_name(file_name)) {
+    return read_stream(stdin, view);
+  }
+
+#ifdef _WIN32
+  FILE* file = fopen(file_name, "rb");
+
+  if (!file) {
+    return false;
+  }
 
+  const bool is_read = read_stream(file, view);
+
+  fclose(file);
+
+  return is_read;
+#else
+  const int file = open(file_name, O_RDONLY);
+
+  if (file < 0) {
     return false;
   }
 
-  StringBuffer in_buff;
+  struct stat file_stat;
+
+  if (fstat(file, &file_stat) != 0) {
+    close(file);
 
-  // presumption: all input files have valid content
-  fgets(in_buff, sizeof in_buff, in_file);
+    return false;
+  }
 
-  int in_size;
+  view->size = (size_t)file_stat.st_size;
 
-  sscanf(in_buff, "%d", &in_size);
+  if (view->size == 0) {
+    close(file);
+
+    return true;
+  }
 
-  for (int i = 0; i < in_size; i++) {
-    // presumption: all input files have valid content
-    fgets(in_buff, sizeof in_buff, in_file);  // NOLINT
+  void* const contents = mmap(NULL, view->size, PROT_READ, MAP_PRIVATE, file, 0);
 
-    Point* point = &points[i];
+  close(file);
 
-    sscanf(in_buff, " %lf %lf", &point->x, &point->y);
+  if (contents == MAP_FAILED) {
+    return false;
   }
 
-  *point_cnt = in_size;
+  posix_madvise(contents, view->size, POSIX_MADV_SEQUENTIAL);
 
-  fclose(in_file);
+  view->contents = contents;
+  view->is_mapped = true;
 
   return true;
+#endif
 }
 
 /**
- * @brief Writes an output file containing a list of points.
- * @details This writes to the file following the format prescribed by the specifications.
- * @param[in] out_file_name The name of the file to write to.
- * @param[in] points The points to use.
- * @param point_cnt The number of points to use.
- * @return Whether the output file was found and written to.
+ * @brief Unmaps a file's contents from memory.
+ * @param[in,out] view The view of the file's contents to unmap.
  */
-bool write_output_file(const StringBuffer out_file_name, const Point* const points, const size_t point_cnt) {
-  FILE* out_file = fopen(out_file_name, "w");
+static void unmap_file(FileView* const view) {
+#ifndef _WIN32
+  if (view->is_mapped) {
+    munmap((void*)view->contents, view->size);
+  } else
+#endif
+  {
+    free((char*)view->contents);
+  }
 
-  if (!out_file) {
-    printf("File %s not found.\n", out_file_name);
+  view->contents = NULL;
+  view->size = 0;
+  view->is_mapped = false;
+}
+
+/** @brief The bytes every binary point file starts with. */
+#define BINARY_FILE_MAGIC "CHPOINTS"
+
+/** @brief The version of the binary point file format written by this program. */
+#define BINARY_FILE_VERSION 1
+
+/** @brief The number of coordinates staged in memory when writing the columnar layout. */
+#define COLUMN_BLOCK_SIZE 4096
+
+/**
+ * @brief The header at the start of a binary point file.
+ * @details Every field is naturally aligned, so the header is 64 bytes with no padding, and the coordinates after it
+ * are aligned for doubles. The fields use the byte order of the machine that wrote the file. A mismatched byte order
+ * shows up as an unknown version.
+ */
+typedef struct BinaryFileHeader {
+  /** @brief The `BINARY_FILE_MAGIC` bytes, without a null character ending. */
+  char magic[8];
+  /** @brief The version of the binary point file format. */
+  uint32_t version;
+  /** @brief The `PointFileLayout` of the coordinates. */
+  uint32_t layout;
+  /** @brief The number of points in the file. */
+  uint64_t point_count;
+  /** @brief The lowest x-coordinate of the points. */
+  double min_x;
+  /** @brief The lowest y-coordinate of the points. */
+  double min_y;
+  /** @brief The highest x-coordinate of the points. */
+  double max_x;
+  /** @brief The highest y-coordinate of the points. */
+  double max_y;
+  /** @brief Unused space for future fields. This is always zero. */
+  uint64_t reserved;
+} BinaryFileHeader;
+
+/**
+ * @brief Checks if a file's contents start with a binary point file header.
+ * @param[in] in_file The view of the file's contents to check.
+ * @return Whether the file is a binary point file.
+ */
+static bool is_binary_file(const FileView* const in_file) {
+  return in_file->size >= sizeof(BinaryFileHeader) &&
+         memcmp(in_file->contents, BINARY_FILE_MAGIC, sizeof BINARY_FILE_MAGIC - 1) == 0;
+}
+
+/**
+ * @brief Copies the points out of a binary point file's contents.
+ * @details This validates the header against the size of the file. The interleaved layout is copied as is, and the
+ * columnar layout is interleaved while copying.
+ * @param[in] in_file The view of the binary point file's contents.
+ * @param[out] points The points copied from the file.
+ * @return Whether the file's header was valid and the points were copied.
+ */
+static bool read_binary_points(const FileView* const in_file, PointBuffer* const points) {
+  BinaryFileHeader header;
 
+  memcpy(&header, in_file->contents, sizeof header);
+
+  const size_t coordinates_size = in_file->size - sizeof header;
+
+  if (header.version != BINARY_FILE_VERSION ||
+      (header.layout != INTERLEAVED_LAYOUT && header.layout != COLUMNAR_LAYOUT) ||
+      header.point_count > coordinates_size / sizeof(Point) || !reserve_points(points, (size_t)header.point_count)) {
     return false;
   }
 
-  fprintf(out_file, "%d\n", (int)point_cnt);
+  const size_t point_cnt = (size_t)header.point_count;
+  const char* const coordinates = in_file->contents + sizeof header;
 
-  for (size_t i = 0; i < point_cnt; i++) {
-    const Point* const point = &points[i];
+  if (header.layout == INTERLEAVED_LAYOUT) {
+    memcpy(points->elements, coordinates, point_cnt * sizeof(Point));
+  } else {
+    const double* const x_coordinates = (const double*)coordinates;
+    const double* const y_coordinates = x_coordinates + point_cnt;
 
-    fprintf(out_file, "%lf  %lf\n", point->x, point->y);
+    for (size_t i = 0; i < point_cnt; i++) {
+      points->elements[i].x = x_coordinates[i];
+      points->elements[i].y = y_coordinates[i];
+    }
   }
 
-  fclose(out_file);
+  points->count = point_cnt;
 
   return true;
 }
+
+/**
+ * @brief Parses an input file containing the data of a list of points.
+ * @details This assumes that the input file follows the format prescribed by the specifications, or is a binary point
+ * file. The point buffer is grown once to fit the number of points declared by the input file. `STANDARD_STREAM_NAME`
+ * parses the standard input instead.
+ * @param[in] in_file_name The name of the file to parse.
+ * @param[out] points The points parsed from the input file.
+ * @return Whether the input file was found and parsed.
+ */
+bool parse_points_from_file(const StringBuffer in_file_name, PointBuffer* const points) {
+  return parse_points_from_file_in_parallel(in_file_name, points, 1);
+}
+
+/**
+ * @brief Parses an input file containing the data of a list of points using multiple threads.
+ * @details This maps the input file into memory and walks it once, parsing the numbers in place. The points are split
+ * between the threads by newline-aligned chunks, but small files are always parsed by a single thread. Binary point
+ * files are detected by their header and copied out of the mapping without any parsing. The point buffer is grown once
+ * to fit the number of points declared by the input file.
+ * @param[in] in_file_name The name of the file to parse.
+ * @param[out] points The points parsed from the input file.
+ * @param thread_cnt The maximum number of threads to parse with.
+ * @return Whether the input file was found and parsed.
+ */
+bool parse_points_from_file_in_parallel(const StringBuffer in_file_name, PointBuffer* const points,
+                                        const size_t thread_cnt) {
+  FileView in_file;
+
+  if (!map_file(in_file_name, &in_file)) {
+    printf("File %s not found.\n", in_file_name);
+
+    return false;
+  }
+
+  points->count = 0;
+
+  if (is_binary_file(&in_file)) {
+    const bool is_read = read_binary_points(&in_file, points);
+
+    if (!is_read) {
+      printf("File %s is malformed.\n", in_file_name);
+    }
+
+    unmap_file(&in_file);
+
+    return is_read;
+  }
+
+  const char* const in_file_end = in_file.contents + in_file.size;
+  uint64_t point_cnt;
+  const char* const cursor = parse_point_count(skip_whitespace(in_file.contents, in_file_end), in_file_end,
+                                               &point_cnt);
+
+  if (!cursor) {
+    printf("File %s is malformed.\n", in_file_name);
+    unmap_file(&in_file);
+
+    return false;
+  }
+
+  // a count too large for the address space can never be reserved, so it is reported as too many points
+  const size_t in_size = point_cnt <= SIZE_MAX ? (size_t)point_cnt : SIZE_MAX;
+  bool is_parsed = reserve_points(points, in_size);
+
+  if (!is_parsed) {
+    printf("File %s has too many points.\n", in_file_name);
+  } else {
+    const size_t max_thread_cnt = (size_t)(in_file_end - cursor) / MIN_PARSE_CHUNK_SIZE;
+    const size_t used_thread_cnt = thread_cnt < max_thread_cnt ? thread_cnt : max_thread_cnt;
+
+    if (used_thread_cnt > 1) {
+      is_parsed = parse_points_in_parallel(cursor, in_file_end, in_size, used_thread_cnt, points);
+    } else {
+      is_parsed = parse_points(cursor, in_file_end, in_size, points->elements, &points->count) != NULL;
+    }
+
+    if (!is_parsed) {
+      printf("File %s is malformed.\n", in_file_name);
+    }
+  }
+
+  unmap_file(&in_file);
+
+  return is_parsed;
+}
+
+/** @brief The number of bytes of a streamed text file that are read at a time. */
+#define STREAM_BUFFER_SIZE (1 << 22)
+
+/** @brief The number of coordinates of each column that are read at a time from a streamed columnar binary file. */
+#define STREAM_COLUMN_SIZE (1 << 16)
+
+/**
+ * @brief Reads bytes from a file, and hints the kernel about the bytes around them.
+ * @details On POSIX systems, the bytes just read are dropped from the page cache, since they are never read again, and
+ * as many bytes after them are read ahead in the background while the current ones are processed. Pipes can't be
+ * hinted, which is harmless.
+ * @param[in,out] file The file to read from.
+ * @param[out] bytes The array to read into.
+ * @param size The maximum number of bytes to read.
+ * @return The number of bytes read, which is less than `size` only at the end of the file or on an error.
+ */
+static size_t read_file_bytes(FILE* const file, void* const bytes, const size_t size) {
+  const size_t read_size = fread(bytes, 1, size, file);
+
+#ifndef _WIN32
+  const off_t offset = ftello(file);
+
+  if (offset >= 0 && read_size > 0) {
+    const int descriptor = fileno(file);
+
+    posix_fadvise(descriptor, offset - (off_t)read_size, (off_t)read_size, POSIX_FADV_DONTNEED);
+    posix_fadvise(descriptor, offset, (off_t)read_size, POSIX_FADV_WILLNEED);
+  }
+#endif
+
+  return read_size;
+}
+
+/**
+ * @brief Moves the position of a file to a byte offset from its start.
+ * @details The offset can be past what a `long` holds on Windows, so each platform's 64-bit seek is used instead of
+ * `fseek`.
+ * @param[in,out] file The file to seek.
+ * @param offset The byte offset to move to. This must fit into a signed 64-bit integer.
+ * @return Whether the position could be moved.
+ */
+static bool seek_file(FILE* const file, const uint64_t offset) {
+#ifdef _WIN32
+  return _fseeki64(file, (__int64)offset, SEEK_SET) == 0;
+#else
+  return fseeko(file, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+/**
+ * @brief Opens a file to be read sequentially in large blocks.
+ * @details The standard library's buffering is disabled, since every read is already larger than its buffer.
+ * @param[in] file_name The name of the file to open.
+ * @return The opened file, or `NULL` if it wasn't found.
+ */
+static FILE* open_sequential_file(const char* const file_name) {
+  FILE* const file = fopen(file_name, "rb");
+
+  if (!file) {
+    return NULL;
+  }
+
+  setvbuf(file, NULL, _IONBF, 0);
+
+#ifndef _WIN32
+  posix_fadvise(fileno(file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+  return file;
+}
+
+/**
+ * @brief Moves the unparsed bytes of a stream's buffer to its start, and fills the rest of it from the file.
+ * @param[in,out] stream The stream to fill.
+ * @return Whether the file could be read.
+ */
+static bool fill_stream_buffer(PointStream* const stream) {
+  const size_t pending_size = stream->buffer_end - stream->buffer_start;
+
+  memmove(stream->buffer, &stream->buffer[stream->buffer_start], pending_size);
+
+  const size_t read_size =
+      read_file_bytes(stream->file, &stream->buffer[pending_size], STREAM_BUFFER_SIZE - pending_size);
+
+  stream->buffer_start = 0;
+  stream->buffer_end = pending_size + read_size;
+  stream->is_at_end = read_size < STREAM_BUFFER_SIZE - pending_size;
+
+  return !ferror(stream->file);
+}
+
+/**
+ * @brief Reads bytes from a stream, starting with the unparsed bytes of its buffer.
+ * @param[in,out] stream The stream to read from.
+ * @param[out] bytes The array to read into.
+ * @param size The number of bytes to read.
+ * @return Whether all of the bytes were read.
+ */
+static bool read_stream_bytes(PointStream* const stream, void* const bytes, const size_t size) {
+  const size_t pending_size = stream->buffer_end - stream->buffer_start;
+  const size_t buffered_size = size < pending_size ? size : pending_size;
+
+  memcpy(bytes, &stream->buffer[stream->buffer_start], buffered_size);
+  stream->buffer_start += buffered_size;
+
+  return buffered_size == size ||
+         read_file_bytes(stream->file, (char*)bytes + buffered_size, size - buffered_size) == size - buffered_size;
+}
+
+/**
+ * @brief Opens an input file to be read a chunk of points at a time.
+ * @details The file can be in the format prescribed by the specifications, or a binary point file.
+ * `STANDARD_STREAM_NAME` reads the standard input instead, unless it is a columnar binary point file, which needs to be
+ * read at two positions at once.
+ * @relates PointStream
+ * @param[in] file_name The name of the file to open. This must outlive the stream.
+ * @param[out] stream The stream of the file's points.
+ * @return Whether the file was found and its header was valid.
+ */
+bool open_point_stream(const char* const file_name, PointStream* const stream) {
+  const bool is_standard_input = is_standard_stream_name(file_name);
+
+  stream->file_name = file_name;
+  stream->file = is_standard_input ? stdin : open_sequential_file(file_name);
+  stream->y_file = NULL;
+  stream->buffer = malloc(STREAM_BUFFER_SIZE);
+  stream->columns = NULL;
+  stream->buffer_start = 0;
+  stream->buffer_end = 0;
+  stream->is_binary = false;
+  stream->is_at_end = false;
+  stream->remaining_point_count = 0;
+
+  if (!stream->file || !stream->buffer || !fill_stream_buffer(stream)) {
+    printf("File %s not found.\n", file_name);
+    close_point_stream(stream);
+
+    return false;
+  }
+
+  stream->is_binary = stream->buffer_end >= sizeof(BinaryFileHeader) &&
+                      memcmp(stream->buffer, BINARY_FILE_MAGIC, sizeof BINARY_FILE_MAGIC - 1) == 0;
+
+  if (!stream->is_binary) {
+    const char* const buffer_end = &stream->buffer[stream->buffer_end];
+    const char* const cursor = parse_point_count(skip_whitespace(stream->buffer, buffer_end), buffer_end,
+                                                 &stream->remaining_point_count);
+
+    if (!cursor) {
+      printf("File %s is malformed.\n", file_name);
+      close_point_stream(stream);
+
+      return false;
+    }
+
+    stream->buffer_start = (size_t)(cursor - stream->buffer);
+
+    return true;
+  }
+
+  BinaryFileHeader header;
+
+  memcpy(&header, stream->buffer, sizeof header);
+  stream->buffer_start = sizeof header;
+  stream->remaining_point_count = header.point_count;
+
+  bool is_valid = header.version == BINARY_FILE_VERSION &&
+                  (header.layout == INTERLEAVED_LAYOUT || header.layout == COLUMNAR_LAYOUT) &&
+                  header.point_count <= (uint64_t)INT64_MAX / sizeof(Point);
+
+  if (is_valid && header.layout == COLUMNAR_LAYOUT) {
+    stream->y_file = is_standard_input ? NULL : open_sequential_file(file_name);
+    stream->columns = malloc(2 * STREAM_COLUMN_SIZE * sizeof(double));
+    is_valid = stream->y_file && stream->columns &&
+               seek_file(stream->y_file, sizeof header + header.point_count * sizeof(double));
+  }
+
+  if (!is_valid) {
+    printf("File %s is malformed.\n", file_name);
+    close_point_stream(stream);
+  }
+
+  return is_valid;
+}
+
+/**
+ * @brief Parses the next chunk of points of a text file, filling the stream's buffer as needed.
+ * @details A point is only parsed once both of its numbers are followed by whitespace or the end of the file, so a
+ * number cut off by the end of the buffer is left for the next fill.
+ * @param[in,out] stream The stream to read from.
+ * @param[out] points The points parsed from the file.
+ * @param max_point_cnt The maximum number of points to parse.
+ * @param[out] point_cnt The number of points parsed, which is less than `max_point_cnt` at the end of the file.
+ * @return Whether the points were well-formed.
+ */
+static bool read_text_point_chunk(PointStream* const stream, Point* const points, const size_t max_point_cnt,
+                                  size_t* const point_cnt) {
+  while (*point_cnt < max_point_cnt) {
+    const char* cursor = &stream->buffer[stream->buffer_start];
+    const char* parse_end = &stream->buffer[stream->buffer_end];
+
+    if (!stream->is_at_end) {
+      while (parse_end > cursor && !isspace((unsigned char)parse_end[-1])) {
+        parse_end--;
+      }
+    }
+
+    while (*point_cnt < max_point_cnt) {
+      const char* const point_start = skip_whitespace(cursor, parse_end);
+
+      if (point_start == parse_end) {
+        cursor = point_start;
+
+        break;
+      }
+
+      Point point;
+      const char* point_end = parse_decimal(point_start, parse_end, &point.x);
+
+      if (point_end) {
+        point_end = skip_whitespace(point_end, parse_end);
+
+        if (point_end == parse_end && !stream->is_at_end) {
+          cursor = point_start;
+
+          break;
+        }
+
+        point_end = parse_decimal(point_end, parse_end, &point.y);
+      }
+
+      if (!point_end) {
+        return false;
+      }
+
+      points[(*point_cnt)++] = point;
+      cursor = point_end;
+    }
+
+    stream->buffer_start = (size_t)(cursor - stream->buffer);
+
+    if (*point_cnt == max_point_cnt || stream->is_at_end) {
+      return true;
+    }
+
+    // a single point that fills the whole buffer can't be parsed
+    if (stream->buffer_start == 0 && stream->buffer_end == STREAM_BUFFER_SIZE) {
+      return false;
+    }
+
+    if (!fill_stream_buffer(stream)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Reads the next chunk of points of a columnar binary point file.
+ * @details The x and y-coordinates are read a block at a time from their own positions in the file, and interleaved
+ * into the points.
+ * @param[in,out] stream The stream to read from.
+ * @param[out] points The points read from the file.
+ * @param point_cnt The number of points to read.
+ * @return Whether all of the points were read.
+ */
+static bool read_columnar_point_chunk(PointStream* const stream, Point* const points, const size_t point_cnt) {
+  double* const x_column = stream->columns;
+  double* const y_column = &stream->columns[STREAM_COLUMN_SIZE];
+
+  for (size_t i = 0; i < point_cnt; i += STREAM_COLUMN_SIZE) {
+    const size_t block_point_cnt = point_cnt - i < STREAM_COLUMN_SIZE ? point_cnt - i : STREAM_COLUMN_SIZE;
+    const size_t block_size = block_point_cnt * sizeof(double);
+
+    if (!read_stream_bytes(stream, x_column, block_size) ||
+        read_file_bytes(stream->y_file, y_column, block_size) != block_size) {
+      return false;
+    }
+
+    for (size_t j = 0; j < block_point_cnt; j++) {
+      points[i + j].x = x_column[j];
+      points[i + j].y = y_column[j];
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Reads the next chunk of points of an input file.
+ * @relates PointStream
+ * @param[in,out] stream The stream to read from.
+ * @param[out] points The points read from the file.
+ * @param max_point_cnt The maximum number of points to read, which `points` must be able to contain.
+ * @param[out] point_cnt The number of points read, which is zero at the end of the file.
+ * @return Whether the points were well-formed.
+ */
+bool read_point_chunk(PointStream* const stream, Point* const points, const size_t max_point_cnt,
+                      size_t* const point_cnt) {
+  const size_t chunk_point_cnt =
+      stream->remaining_point_count < max_point_cnt ? (size_t)stream->remaining_point_count : max_point_cnt;
+  bool is_read;
+
+  *point_cnt = 0;
+
+  if (!stream->is_binary) {
+    is_read = read_text_point_chunk(stream, points, chunk_point_cnt, point_cnt);
+
+    // like `parse_points_from_file`, a text file can end before the number of points it declared
+    if (*point_cnt < chunk_point_cnt) {
+      stream->remaining_point_count = *point_cnt;
+    }
+  } else {
+    is_read = stream->y_file ? read_columnar_point_chunk(stream, points, chunk_point_cnt)
+                             : read_stream_bytes(stream, points, chunk_point_cnt * sizeof(Point));
+    *point_cnt = is_read ? chunk_point_cnt : 0;
+  }
+
+  stream->remaining_point_count -= *point_cnt;
+
+  if (!is_read) {
+    printf("File %s is malformed.\n", stream->file_name);
+  }
+
+  return is_read;
+}
+
+/**
+ * @brief Closes an input file read a chunk of points at a time.
+ * @relates PointStream
+ * @param[in,out] stream The stream to close.
+ */
+void close_point_stream(PointStream* const stream) {
+  if (stream->file && stream->file != stdin) {
+    fclose(stream->file);
+  }
+
+  if (stream->y_file) {
+    fclose(stream->y_file);
+  }
+
+  free(stream->buffer);
+  free(stream->columns);
+
+  stream->file = NULL;
+  stream->y_file = NULL;
+  stream->buffer = NULL;
+  stream->columns = NULL;
+}
+
+/** @brief The number of bytes an output file is formatted into before it is written. */
+#define OUTPUT_BUFFER_SIZE (1 << 20)
+
+/** @brief The maximum number of characters a formatted double takes. */
+#define MAX_FORMATTED_DOUBLE_SIZE 32
+
+/**
+ * @brief The lowest number of significant digits tried when a normal double isn't a short decimal.
+ * @details Every decimal of up to 15 significant digits round-trips through a normal double, so fewer digits never
+ * need to be tried.
+ */
+#define MIN_ROUND_TRIP_PRECISION 15
+
+/** @brief The number of significant digits that always round-trips a double. */
+#define MAX_ROUND_TRIP_PRECISION 17
+
+/** @brief An output file's contents, formatted into a large buffer and written with few system calls. */
+typedef struct OutputBuffer {
+  /** @brief The file to write to. */
+  FILE* file;
+  /** @brief The formatted contents that have yet to be written. */
+  char* data;
+  /** @brief The number of formatted characters that have yet to be written. */
+  size_t length;
+  /** @brief Whether every write so far succeeded. */
+  bool is_written;
+} OutputBuffer;
+
+/**
+ * @brief Writes the formatted contents of an output buffer to its file.
+ * @details The contents are written with `write` directly, bypassing the file's own buffering, and partial writes are
+ * continued until everything is written.
+ * @param[in,out] buffer The output buffer to flush.
+ */
+static void flush_output_buffer(OutputBuffer* const buffer) {
+  const char* data = buffer->data;
+  size_t remaining_len = buffer->length;
+
+  buffer->length = 0;
+
+#ifdef _WIN32
+  buffer->is_written = buffer->is_written && fwrite(data, 1, remaining_len, buffer->file) == remaining_len;
+#else
+  const int file_descriptor = fileno(buffer->file);
+
+  while (buffer->is_written && remaining_len > 0) {
+    const ssize_t written_len = write(file_descriptor, data, remaining_len);
+
+    if (written_len < 0) {
+      buffer->is_written = errno == EINTR;
+    } else {
+      data += written_len;
+      remaining_len -= (size_t)written_len;
+    }
+  }
+#endif
+}
+
+/**
+ * @brief Formats a double with the fewest digits that parse back to exactly the same double.
+ * @details Most coordinates are short decimals, so this first looks for the fewest decimal places `k` where the double
+ * multiplied by `10^k` rounds to an integer below `2^53`. Dividing that integer by the exact power of ten is correctly
+ * rounded, so if it gives back the double, printing the integer with `k` decimal places round-trips. Otherwise, this
+ * tries 15, 16, and 17 significant digits, keeping the first that `strtod` parses back to the double. Subnormal doubles
+ * have fewer significant bits, so their search starts from a single significant digit instead.
+ * @param value The double to format.
+ * @param[out] string The string to format into. This must be able to contain `MAX_FORMATTED_DOUBLE_SIZE` characters.
+ * @return The number of characters formatted, excluding the null character ending.
+ */
+static size_t format_double(const double value, char* const string) {
+  if (!isfinite(value)) {
+    return (size_t)snprintf(string, MAX_FORMATTED_DOUBLE_SIZE, "%g", value);
+  }
+
+  const double magnitude = fabs(value);
+
+  for (int decimal_place_cnt = 0; decimal_place_cnt <= MAX_EXACT_POWER_OF_TEN; decimal_place_cnt++) {
+    const double scaled_magnitude = magnitude * EXACT_POWERS_OF_TEN[decimal_place_cnt];
+
+    if (scaled_magnitude >= (double)MAX_EXACT_DOUBLE_INTEGER) {
+      break;
+    }
+
+    // the multiplication can round a short decimal off of an integer, so the nearest integer is checked instead
+    const uint64_t mantissa = (uint64_t)(scaled_magnitude + 0.5);
+
+    if ((double)mantissa / EXACT_POWERS_OF_TEN[decimal_place_cnt] != magnitude) {
+      continue;
+    }
+
+    // the digits are formatted backwards, with enough leading zeros for a digit before the decimal point
+    char digits[MAX_FORMATTED_DOUBLE_SIZE];
+    size_t digit_cnt = 0;
+    uint64_t remaining_mantissa = mantissa;
+
+    do {
+      digits[digit_cnt++] = (char)('0' + remaining_mantissa % 10);
+      remaining_mantissa /= 10;
+    } while (remaining_mantissa > 0 || digit_cnt <= (size_t)decimal_place_cnt);
+
+    size_t string_len = 0;
+
+    if (signbit(value)) {
+      string[string_len++] = '-';
+    }
+
+    while (digit_cnt > 0) {
+      if (digit_cnt == (size_t)decimal_place_cnt) {
+        string[string_len++] = '.';
+      }
+
+      string[string_len++] = digits[--digit_cnt];
+    }
+
+    string[string_len] = '\0';
+
+    return string_len;
+  }
+
+  int string_len = 0;
+
+  for (int precision = magnitude < DBL_MIN ? 1 : MIN_ROUND_TRIP_PRECISION; precision <= MAX_ROUND_TRIP_PRECISION;
+       precision++) {
+    string_len = snprintf(string, MAX_FORMATTED_DOUBLE_SIZE, "%.*g", precision, value);
+
+    if (strtod(string, NULL) == value) {
+      break;
+    }
+  }
+
+  return (size_t)string_len;
+}
+
+/**
+ * @brief Appends characters to an output buffer, writing it to its file first if they don't fit.
+ * @param[in,out] buffer The output buffer to append to.
+ * @param[in] string The characters to append.
+ * @param string_len The number of characters to append. This must be at most `OUTPUT_BUFFER_SIZE`.
+ */
+static void append_output(OutputBuffer* const buffer, const char* const string, const size_t string_len) {
+  if (buffer->length + string_len > OUTPUT_BUFFER_SIZE) {
+    flush_output_buffer(buffer);
+  }
+
+  memcpy(&buffer->data[buffer->length], string, string_len);
+
+  buffer->length += string_len;
+}
+
+/**
+ * @brief Writes an output file containing a list of points.
+ * @details This writes to the file following the format prescribed by the specifications. Every coordinate is written
+ * with the fewest digits that parse back to exactly the same double, and the lines are formatted into a large buffer
+ * that is written with few system calls. If the file name ends with `BINARY_FILE_EXTENSION`, this writes a binary
+ * point file with the interleaved layout instead. `STANDARD_STREAM_NAME` writes to the standard output instead.
+ * @param[in] out_file_name The name of the file to write to.
+ * @param[in] points The points to use.
+ * @param point_cnt The number of points to use.
+ * @return Whether the output file was found and written to.
+ */
+bool write_output_file(const StringBuffer out_file_name, const Point* const points, const size_t point_cnt) {
+  if (is_binary_file_name(out_file_name) && !is_standard_stream_name(out_file_name)) {
+    return write_binary_file(out_file_name, points, point_cnt, INTERLEAVED_LAYOUT);
+  }
+
+  const bool is_standard_output = is_standard_stream_name(out_file_name);
+  FILE* out_file = is_standard_output ? stdout : fopen(out_file_name, "w");
+
+  if (!out_file) {
+    printf("File %s not found.\n", out_file_name);
+
+    return false;
+  }
+
+  OutputBuffer buffer = {out_file, malloc(OUTPUT_BUFFER_SIZE), 0, true};
+
+  // anything already printed to the standard output must come before the points written past its buffering
+  buffer.is_written = buffer.data && fflush(out_file) == 0;
+
+  if (buffer.is_written) {
+    char line[2 * MAX_FORMATTED_DOUBLE_SIZE + 4];
+    const size_t count_line_len = (size_t)snprintf(line, sizeof line, "%zu\n", point_cnt);
+
+    append_output(&buffer, line, count_line_len);
+
+    for (size_t i = 0; i < point_cnt; i++) {
+      const Point* const point = &points[i];
+      size_t line_len = format_double(point->x, line);
+
+      line[line_len++] = ' ';
+      line[line_len++] = ' ';
+      line_len += format_double(point->y, &line[line_len]);
+      line[line_len++] = '\n';
+
+      append_output(&buffer, line, line_len);
+    }
+
+    flush_output_buffer(&buffer);
+  }
+
+  free(buffer.data);
+
+  if (!is_standard_output && fclose(out_file) != 0) {
+    buffer.is_written = false;
+  }
+
+  if (!buffer.is_written) {
+    printf("File %s could not be written to.\n", out_file_name);
+
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Writes a snapshot of a convex hull to a stream.
+ * @details The snapshot starts with a line containing the time it was taken at and the number of points, followed by
+ * the points in the same format as `write_output_file`. The lines go through the stream's own buffering, so many small
+ * snapshots are written with few system calls.
+ * @param[in,out] stream The stream to write to.
+ * @param time The time the snapshot was taken at, in seconds.
+ * @param[in] points The points to use.
+ * @param point_cnt The number of points to use.
+ * @return Whether the snapshot was written to the stream.
+ */
+bool write_snapshot(FILE* const stream, const double time, const Point* const points, const size_t point_cnt) {
+  char line[2 * MAX_FORMATTED_DOUBLE_SIZE + 4];
+  size_t line_len = format_double(time, line);
+
+  line_len += (size_t)snprintf(&line[line_len], sizeof line - line_len, " %zu\n", point_cnt);
+
+  bool is_written = fwrite(line, 1, line_len, stream) == line_len;
+
+  for (size_t i = 0; i < point_cnt && is_written; i++) {
+    const Point* const point = &points[i];
+
+    line_len = format_double(point->x, line);
+    line[line_len++] = ' ';
+    line[line_len++] = ' ';
+    line_len += format_double(point->y, &line[line_len]);
+    line[line_len++] = '\n';
+
+    is_written = fwrite(line, 1, line_len, stream) == line_len;
+  }
+
+  return is_written;
+}
+
+/**
+ * @brief Prints a point as a pair of coordinates in parentheses, preceded by a space.
+ * @param[in,out] stream The stream to print to.
+ * @param[in] point The point to print.
+ */
+static void print_point(FILE* const stream, const Point* const point) {
+  char x[MAX_FORMATTED_DOUBLE_SIZE];
+  char y[MAX_FORMATTED_DOUBLE_SIZE];
+
+  format_double(point->x, x);
+  format_double(point->y, y);
+  fprintf(stream, " (%s, %s)", x, y);
+}
+
+/**
+ * @brief Prints the metrics of a convex hull.
+ * @details Every metric is printed on its own line, followed by the points that locate it. The coordinates are printed
+ * with the fewest digits that parse back to exactly the same double, like `write_output_file`.
+ * @param[in,out] stream The stream to print to.
+ * @param[in] metrics The metrics to print.
+ */
+void print_hull_metrics(FILE* const stream, const HullMetrics* const metrics) {
+  const char* const segment_names[] = {"Diameter", "Width"};
+  const LineSegment* const segments[] = {&metrics->diameter, &metrics->width};
+  char value[MAX_FORMATTED_DOUBLE_SIZE];
+
+  for (size_t i = 0; i < sizeof(segments) / sizeof(segments[0]); i++) {
+    format_double(segments[i]->length, value);
+    fprintf(stream, "%s: %s", segment_names[i], value);
+    print_point(stream, &segments[i]->start);
+    print_point(stream, &segments[i]->end);
+    fputc('\n', stream);
+  }
+
+  const char* const rectangle_names[] = {"Minimum-area rectangle", "Minimum-perimeter rectangle"};
+  const OrientedRectangle* const rectangles[] = {&metrics->min_area_rectangle, &metrics->min_perimeter_rectangle};
+
+  for (size_t i = 0; i < sizeof(rectangles) / sizeof(rectangles[0]); i++) {
+    char perimeter[MAX_FORMATTED_DOUBLE_SIZE];
+
+    format_double(rectangles[i]->area, value);
+    format_double(rectangles[i]->perimeter, perimeter);
+    fprintf(stream, "%s: area %s, perimeter %s,", rectangle_names[i], value, perimeter);
+
+    for (size_t j = 0; j < RECTANGLE_CORNER_COUNT; j++) {
+      print_point(stream, &rectangles[i]->corners[j]);
+    }
+
+    fputc('\n', stream);
+  }
+}
+
+/**
+ * @brief Writes a binary point file containing a list of points.
+ * @details The file starts with a header containing the number of points, their bounding box, and the layout of their
+ * coordinates. The coordinates follow as raw doubles, so reading them back needs no parsing.
+ * @param[in] out_file_name The name of the file to write to.
+ * @param[in] points The points to use.
+ * @param point_cnt The number of points to use.
+ * @param layout The arrangement of the coordinates to use.
+ * @return Whether the output file was found and written to.
+ */
+bool write_binary_file(const StringBuffer out_file_name, const Point* const points, const size_t point_cnt,
+                       const PointFileLayout layout) {
+  FILE* out_file = fopen(out_file_name, "wb");
+
+  if (!out_file) {
+    printf("File %s not found.\n", out_file_name);
+
+    return false;
+  }
+
+  BinaryFileHeader header;
+
+  memset(&header, 0, sizeof header);
+  memcpy(header.magic, BINARY_FILE_MAGIC, sizeof header.magic);
+
+  header.version = BINARY_FILE_VERSION;
+  header.layout = layout;
+  header.point_count = point_cnt;
+
+  for (size_t i = 0; i < point_cnt; i++) {
+    const Point* const point = &points[i];
+
+    if (i == 0 || point->x < header.min_x) {
+      header.min_x = point->x;
+    }
+
+    if (i == 0 || point->y < header.min_y) {
+      header.min_y = point->y;
+    }
+
+    if (i == 0 || point->x > header.max_x) {
+      header.max_x = point->x;
+    }
+
+    if (i == 0 || point->y > header.max_y) {
+      header.max_y = point->y;
+    }
+  }
+
+  bool is_written = fwrite(&header, sizeof header, 1, out_file) == 1;
+
+  if (layout == INTERLEAVED_LAYOUT) {
+    is_written = is_written && fwrite(points, sizeof(Point), point_cnt, out_file) == point_cnt;
+  } else {
+    double column_block[COLUMN_BLOCK_SIZE];
+
+    for (size_t coordinate_idx = 0; coordinate_idx < 2; coordinate_idx++) {
+      for (size_t i = 0; is_written && i < point_cnt; i += COLUMN_BLOCK_SIZE) {
+        const size_t block_size = point_cnt - i < COLUMN_BLOCK_SIZE ? point_cnt - i : COLUMN_BLOCK_SIZE;
+
+        for (size_t j = 0; j < block_size; j++) {
+          column_block[j] = coordinate_idx == 0 ? points[i + j].x : points[i + j].y;
+        }
+
+        is_written = fwrite(column_block, sizeof(double), block_size, out_file) == block_size;
+      }
+    }
+  }
+
+  if (fclose(out_file) != 0 || !is_written) {
+    printf("File %s could not be written to.\n", out_file_name);
+
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Checks if a file name has the binary point file extension.
+ * @param[in] file_name The file name to check.
+ * @return Whether the file name ends with `BINARY_FILE_EXTENSION`.
+ */
+bool is_binary_file_name(const char* const file_name) {
+  const size_t file_name_len = strlen(file_name);
+  const size_t extension_len = strlen(BINARY_FILE_EXTENSION);
+
+  return file_name_len >= extension_len &&
+         strcmp(&file_name[file_name_len - extension_len], BINARY_FILE_EXTENSION) == 0;
+}
@@ -29,8 +29,13 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 
-#include "convex_hull/geometry.h"
+#include "convex_hull/approximate_hull.h"
+#include "convex_hull/point_buffer.h"
+#include "convex_hull/rotating_calipers.h"
+#include "convex_hull/sliding_hull.h"
 
 /** @brief The maximum number of characters a string input operation will handle. */
 #define BUFFER_SIZE 32
@@ -38,25 +43,241 @@
 /** @brief A string that can contain the `BUFFER_SIZE` and a null character ending (`BUFFER_SIZE + 1`). */
 typedef char StringBuffer[BUFFER_SIZE + 1];
 
+/** @brief The maximum number of characters of a line of a manifest file. */
+#define MANIFEST_LINE_SIZE 4096
+
+/** @brief A line of a manifest file that can contain `MANIFEST_LINE_SIZE` and a null character ending. */
+typedef char ManifestLine[MANIFEST_LINE_SIZE + 1];
+
+/** @brief The maximum number of characters of a line of a timestamped point stream. */
+#define STREAM_LINE_SIZE 256
+
+/** @brief A line of a timestamped point stream that can contain `STREAM_LINE_SIZE` and a null character ending. */
+typedef char StreamLine[STREAM_LINE_SIZE + 1];
+
+/** @brief The number of points read at a time when streaming an input file, unless a number is given. */
+#define DEFAULT_STREAM_CHUNK_SIZE ((size_t)1 << 22)
+
+/** @brief The file name that refers to the standard input when reading, or the standard output when writing. */
+#define STANDARD_STREAM_NAME "-"
+
+/** @brief The file extension of binary point files. */
+#define BINARY_FILE_EXTENSION ".pts"
+
+/** @brief The arrangements of the coordinates within a binary point file. */
+typedef enum PointFileLayout {
+  /** @brief The coordinates are stored as x and y pairs, exactly like an array of `Point`. */
+  INTERLEAVED_LAYOUT = 0,
+  /** @brief All the x-coordinates are stored first, followed by all the y-coordinates. */
+  COLUMNAR_LAYOUT = 1,
+} PointFileLayout;
+
+/** @brief The algorithms the convex hull can be found with. */
+typedef enum ScanEngine {
+  /** @brief The program's own Graham scan. */
+  GRAHAM_ENGINE = 0,
+  /** @brief Chan's algorithm, which is faster when the convex hull is small. */
+  CHAN_ENGINE = 1,
+  /** @brief The QuickHull algorithm, which splits its subproblems between the threads. */
+  QUICK_ENGINE = 2,
+  /** @brief The Bentley-Faust-Preparata algorithm, which only finds an approximate convex hull in linear time. */
+  APPROXIMATE_ENGINE = 3,
+} ScanEngine;
+
+/** @brief The options of the Graham scan implementations, set by their command-line arguments. */
+typedef struct ScanOptions {
+  /** @brief The number of directions to cull with, or zero if culling is disabled. */
+  size_t cull_direction_count;
+  /** @brief The algorithm to find the convex hull with. */
+  ScanEngine engine;
+  /** @brief The number of strips the points are split into by the approximate engine. */
+  size_t strip_count;
+  /** @brief The maximum number of threads to parse and scan with. */
+  size_t thread_count;
+  /** @brief Whether the metrics of the convex hull are printed after it is found. */
+  bool is_measured;
+  /** @brief The number of points read at a time when streaming the input file, or zero to read it all at once. */
+  size_t stream_chunk_size;
+  /** @brief The name of the input file, or `NULL` if it should be prompted for. */
+  const char* in_file_name;
+  /** @brief The name of the output file, or `NULL` if it should be prompted for. */
+  const char* out_file_name;
+  /** @brief The name of the manifest file listing the input and output files, or `NULL` if there is none. */
+  const char* manifest_file_name;
+} ScanOptions;
+
 /**
  * @brief Gets a string typed input from the user.
  * @param[out] string The input received from the user.
  */
 void get_string_input(StringBuffer string);
 
+/**
+ * @brief Parses the command-line arguments of the Graham scan implementations.
+ * @details `--cull` enables the interior point culling pre-pass with eight directions, and `--cull=4` enables it with
+ * four directions. `--threads=<count>` parses and scans with up to that many threads, and `--threads` with one thread
+ * per processor. Without it, a single thread is used. `--engine=chan` finds the convex hull with Chan's algorithm and
+ * `--engine=quick` with the QuickHull algorithm, instead of the program's own Graham scan, which `--engine=graham`
+ * selects. `--engine=approximate` finds an approximate convex hull with the Bentley-Faust-Preparata algorithm, which
+ * splits the points into `--strips=<count>` strips, or `DEFAULT_APPROXIMATE_STRIP_COUNT` strips without it. `--metrics`
+ * prints the diameter, the width, and the smallest enclosing rectangles of the convex hull.
+ * `--stream=<count>` reads the input file that many points at a time, keeping only the convex hull found so far in
+ * between, and `--stream` reads `DEFAULT_STREAM_CHUNK_SIZE` points at a time. An input and an output file name can be
+ * given to skip the prompts, or `--manifest=<file>` to process every pair of file names listed in the manifest. This
+ * prints the program's usage if an argument is not recognized.
+ * @param argument_count The number of command-line arguments.
+ * @param[in] arguments The command-line arguments.
+ * @param[out] options The options set by the command-line arguments.
+ * @return Whether every argument was recognized.
+ */
+bool parse_arguments(int argument_count, char* const arguments[], ScanOptions* const options);
+
+/**
+ * @brief Reads the next entry of a manifest file.
+ * @details Every line of a manifest file contains an input file name and an output file name, separated by whitespace.
+ * Blank lines are skipped.
+ * @param[in,out] manifest_file The manifest file to read from.
+ * @param[out] line The line of the entry. The file names point into it.
+ * @param[out] in_file_name The input file name of the entry, or `NULL` if the line is malformed.
+ * @param[out] out_file_name The output file name of the entry, or `NULL` if the line is malformed.
+ * @return Whether an entry was read, or `false` at the end of the manifest file.
+ */
+bool read_manifest_entry(FILE* const manifest_file, ManifestLine line, char** const in_file_name,
+                         char** const out_file_name);
+
 /**
  * @brief Parses an input file containing the data of a list of points.
- * @details This assumes that the input file follows the format prescribed by the specifications.
+ * @details This assumes that the input file follows the format prescribed by the specifications, or is a binary point
+ * file. The point buffer is grown once to fit the number of points declared by the input file. `STANDARD_STREAM_NAME`
+ * parses the standard input instead.
+ * @param[in] input_file_name The name of the file to parse.
+ * @param[out] points The points parsed from the input file.
+ * @return Whether the input file was found and parsed.
+ */
+bool parse_points_from_file(const StringBuffer input_file_name, PointBuffer* const points);
+
+/**
+ * @brief Parses an input file containing the data of a list of points using multiple threads.
+ * @details This maps the input file into memory and walks it once, parsing the numbers in place. The points are split
+ * between the threads by newline-aligned chunks, but small files are always parsed by a single thread. Binary point
+ * files are detected by their header and copied out of the mapping without any parsing. The point buffer is grown once
+ * to fit the number of points declared by the input file.
  * @param[in] input_file_name The name of the file to parse.
  * @param[out] points The points parsed from the input file.
- * @param[out] point_count The number of points parsed from the input file.
+ * @param thread_count The maximum number of threads to parse with.
  * @return Whether the input file was found and parsed.
  */
-bool parse_points_from_file(const StringBuffer input_file_name, Point* const points, size_t* const point_count);
+bool parse_points_from_file_in_parallel(const StringBuffer input_file_name, PointBuffer* const points,
+                                        size_t thread_count);
+
+/**
+ * @brief An input file that is read a chunk of points at a time, instead of all at once.
+ * @details Only the unparsed part of the current chunk is kept, so files larger than the memory can be read. The file
+ * is read sequentially without the standard library's buffering. On POSIX systems, the kernel reads ahead of every
+ * chunk while it is processed, and drops the chunks already read from the page cache.
+ */
+typedef struct PointStream {
+  /**
+   * @brief The name of the file, used in the error messages.
+   * @private
+   */
+  const char* file_name;
+  /**
+   * @brief The file being read.
+   * @private
+   */
+  FILE* file;
+  /**
+   * @brief The same file, positioned at the y-coordinates of a columnar binary point file, or `NULL` otherwise.
+   * @private
+   */
+  FILE* y_file;
+  /**
+   * @brief The bytes read from the file and not parsed yet, between `buffer_start` and `buffer_end`.
+   * @private
+   */
+  char* buffer;
+  /**
+   * @brief The blocks of x and y-coordinates of a columnar binary point file, or `NULL` otherwise.
+   * @private
+   */
+  double* columns;
+  /**
+   * @brief The index of the first unparsed byte of the buffer.
+   * @private
+   */
+  size_t buffer_start;
+  /**
+   * @brief The index after the last byte read into the buffer.
+   * @private
+   */
+  size_t buffer_end;
+  /**
+   * @brief Whether the file is a binary point file.
+   * @private
+   */
+  bool is_binary;
+  /**
+   * @brief Whether the last byte of the file was read into the buffer.
+   * @private
+   */
+  bool is_at_end;
+  /**
+   * @brief The number of points declared by the file and not read yet.
+   * @private
+   */
+  uint64_t remaining_point_count;
+} PointStream;
+
+/**
+ * @brief Opens an input file to be read a chunk of points at a time.
+ * @details The file can be in the format prescribed by the specifications, or a binary point file.
+ * `STANDARD_STREAM_NAME` reads the standard input instead, unless it is a columnar binary point file, which needs to be
+ * read at two positions at once.
+ * @relates PointStream
+ * @param[in] file_name The name of the file to open. This must outlive the stream.
+ * @param[out] stream The stream of the file's points.
+ * @return Whether the file was found and its header was valid.
+ */
+bool open_point_stream(const char* const file_name, PointStream* const stream);
+
+/**
+ * @brief Reads the next chunk of points of an input file.
+ * @relates PointStream
+ * @param[in,out] stream The stream to read from.
+ * @param[out] points The points read from the file.
+ * @param max_point_count The maximum number of points to read, which `points` must be able to contain.
+ * @param[out] point_count The number of points read, which is zero at the end of the file.
+ * @return Whether the points were well-formed.
+ */
+bool read_point_chunk(PointStream* const stream, Point* const points, size_t max_point_count,
+                      size_t* const point_count);
+
+/**
+ * @brief Closes an input file read a chunk of points at a time.
+ * @relates PointStream
+ * @param[in,out] stream The stream to close.
+ */
+void close_point_stream(PointStream* const stream);
+
+/**
+ * @brief Reads the next point of a timestamped point stream.
+ * @details Every line of the stream contains the time the point arrived at, in seconds, followed by the point's x and
+ * y-coordinates, separated by whitespace. Blank lines are skipped.
+ * @param[in,out] stream The stream to read from.
+ * @param[out] line The line of the point.
+ * @param[out] point The point parsed from the line.
+ * @param[out] is_parsed Whether the line was well-formed.
+ * @return Whether a line was read, or `false` at the end of the stream.
+ */
+bool read_timed_point(FILE* const stream, StreamLine line, TimedPoint* const point, bool* const is_parsed);
 
 /**
  * @brief Writes an output file containing a list of points.
- * @details This writes to the file following the format prescribed by the specifications.
+ * @details This writes to the file following the format prescribed by the specifications. Every coordinate is written
+ * with the fewest digits that parse back to exactly the same double, and the lines are formatted into a large buffer
+ * that is written with few system calls. If the file name ends with `BINARY_FILE_EXTENSION`, this writes a binary
+ * point file with the interleaved layout instead. `STANDARD_STREAM_NAME` writes to the standard output instead.
  * @param[in] output_file_name The name of the file to write to.
  * @param[in] points The points to use.
  * @param point_count The number of points to use.
@@ -64,4 +285,53 @@ bool parse_points_from_file(const StringBuffer input_file_name, Point* const poi
  */
 bool write_output_file(const StringBuffer output_file_name, const Point* const points, size_t point_count);
 
+/**
+ * @brief Writes a snapshot of a convex hull to a stream.
+ * @details The snapshot starts with a line containing the time it was taken at and the number of points, followed by
+ * the points in the same format as `write_output_file`. The lines go through the stream's own buffering, so many small
+ * snapshots are written with few system calls.
+ * @param[in,out] stream The stream to write to.
+ * @param time The time the snapshot was taken at, in seconds.
+ * @param[in] points The points to use.
+ * @param point_count The number of points to use.
+ * @return Whether the snapshot was written to the stream.
+ */
+bool write_snapshot(FILE* const stream, double time, const Point* const points, size_t point_count);
+
+/**
+ * @brief Prints the metrics of a convex hull.
+ * @details Every metric is printed on its own line, followed by the points that locate it. The coordinates are printed
+ * with the fewest digits that parse back to exactly the same double, like `write_output_file`.
+ * @param[in,out] stream The stream to print to.
+ * @param[in] metrics The metrics to print.
+ */
+void print_hull_metrics(FILE* const stream, const HullMetrics* const metrics);
+
+/**
+ * @brief Writes a binary point file containing a list of points.
+ * @details The file starts with a header containing the number of points, their bounding box, and the layout of their
+ * coordinates. The coordinates follow as raw doubles, so reading them back needs no parsing.
+ * @param[in] output_file_name The name of the file to write to.
+ * @param[in] points The points to use.
+ * @param point_count The number of points to use.
+ * @param layout The arrangement of the coordinates to use.
+ * @return Whether the output file was found and written to.
+ */
+bool write_binary_file(const StringBuffer output_file_name, const Point* const points, size_t point_count,
+                       PointFileLayout layout);
+
+/**
+ * @brief Checks if a file name refers to the standard input or output.
+ * @param[in] file_name The file name to check.
+ * @return Whether the file name is `STANDARD_STREAM_NAME`.
+ */
+bool is_standard_stream_name(const char* const file_name);
+
+/**
+ * @brief Checks if a file name has the binary point file extension.
+ * @param[in] file_name The file name to check.
+ * @return Whether the file name ends with `BINARY_FILE_EXTENSION`.
+ */
+bool is_binary_file_name(const char* const file_name);
+
 #endif  // IO_H_
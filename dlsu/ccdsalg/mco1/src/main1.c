@@ -16,49 +16,13 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <stdio.h>
-#include <time.h>
-
 #include "convex_hull/graham_scan1.h"
-#include "convex_hull/stack.h"
-#include "io.h"
+#include "driver.h"
 
 /**
  * @brief The entry point of the convex hull calculator program with a slower sorting algorithm.
+ * @param argc The number of command-line arguments.
+ * @param[in] argv The command-line arguments.
  * @return The program's resulting exit code.
  */
-int main(void) {
-  printf("Input filename: ");
-
-  StringBuffer in_file_name;
-
-  get_string_input(in_file_name);
-
-  Point points[MAX_STACK_SIZE];
-  size_t point_cnt;
-
-  if (!parse_points_from_file(in_file_name, points, &point_cnt)) {
-    return 1;
-  }
-
-  Point* convex_points;
-  size_t convex_point_cnt;
-
-  const clock_t start_clock = clock();
-
-  slow_scan(points, point_cnt, &convex_points, &convex_point_cnt);
-
-  printf("Execution time: %lfms\n", (double)(clock() - start_clock) / CLOCKS_PER_SEC * 1000);
-
-  printf("Output filename: ");
-
-  StringBuffer out_file_name;
-
-  get_string_input(out_file_name);
-
-  if (!write_output_file(out_file_name, convex_points, convex_point_cnt)) {
-    return 1;
-  }
-
-  return 0;
-}
+int main(const int argc, char* argv[]) { return run_convex_hull_program(argc, argv, slow_scan_in_place); }
@@ -0,0 +1,123 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "convex_hull/monotone_chain.h"
+#include "io.h"
+
+#ifdef CONVEX_HULL_INTEGER_COORDINATES
+#include <stdlib.h>
+
+#include "convex_hull/integer_hull.h"
+
+/**
+ * @brief Scans points with exact integer arithmetic if every coordinate is a 32-bit integer.
+ * @details The points are converted into integer points, scanned with `integer_monotone_chain_scan_into`, and the
+ * convex hull is converted back. Nothing is scanned if there are no points, a coordinate isn't an integer, or the
+ * memory can't be allocated.
+ * @param[in] points The points to scan.
+ * @param[out] convex_points The points from the created convex set.
+ * @return Whether the points were scanned.
+ */
+static bool integer_scan(const PointBuffer* const points, PointBuffer* const convex_points) {
+  if (points->count == 0 || points->count > SIZE_MAX / 2 / sizeof(IntegerPoint) ||
+      !reserve_points(convex_points, points->count)) {
+    return false;
+  }
+
+  IntegerPoint* const integer_points = malloc(2 * points->count * sizeof(IntegerPoint));
+  bool is_scanned = integer_points && to_integer_points(points->elements, points->count, integer_points);
+
+  if (is_scanned) {
+    IntegerPoint* const integer_convex_points = &integer_points[points->count];
+
+    is_scanned = integer_monotone_chain_scan_into(integer_points, points->count, integer_convex_points,
+                                                  points->count, &convex_points->count);
+
+    from_integer_points(integer_convex_points, convex_points->count, convex_points->elements);
+  }
+
+  free(integer_points);
+
+  return is_scanned;
+}
+#endif
+
+/**
+ * @brief The entry point of the convex hull calculator program with Andrew's monotone chain algorithm.
+ * @return The program's resulting exit code.
+ */
+int main(void) {
+  printf("Input filename: ");
+
+  StringBuffer in_file_name;
+
+  get_string_input(in_file_name);
+
+  PointBuffer points;
+
+  create_point_buffer(&points);
+
+  if (!parse_points_from_file(in_file_name, &points)) {
+    destroy_point_buffer(&points);
+
+    return 1;
+  }
+
+  PointBuffer convex_points;
+
+  create_point_buffer(&convex_points);
+
+  const clock_t start_clock = clock();
+
+#ifdef CONVEX_HULL_INTEGER_COORDINATES
+  const bool is_integer_scanned = integer_scan(&points, &convex_points);
+#else
+  const bool is_integer_scanned = false;
+#endif
+
+  if (!is_integer_scanned && !monotone_chain_scan(&points, &convex_points)) {
+    printf("Not enough memory to scan the points.\n");
+
+    destroy_point_buffer(&points);
+    destroy_point_buffer(&convex_points);
+
+    return 1;
+  }
+
+  printf("Execution time: %lfms\n", (double)(clock() - start_clock) / CLOCKS_PER_SEC * 1000);
+
+  printf("Output filename: ");
+
+  StringBuffer out_file_name;
+
+  get_string_input(out_file_name);
+
+  int exit_code = 0;
+
+  if (!write_output_file(out_file_name, convex_points.elements, convex_points.count)) {
+    exit_code = 1;
+  }
+
+  destroy_point_buffer(&points);
+  destroy_point_buffer(&convex_points);
+
+  return exit_code;
+}
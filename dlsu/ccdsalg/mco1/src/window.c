@@ -0,0 +1,231 @@
+/*
+ * Convex Hull finds the convex hull from a set of points on a Cartesian plane.
+ * Copyright (C) 2025  Raphael Panaligan  Jek Degullado
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "convex_hull/point_buffer.h"
+#include "convex_hull/sliding_hull.h"
+#include "io.h"
+
+/** @brief The options of the sliding window program, set by its command-line arguments. */
+typedef struct WindowOptions {
+  /** @brief The number of seconds a point stays within the window, or zero if it isn't limited by time. */
+  double duration;
+  /** @brief The maximum number of points within the window, or zero if it isn't limited by count. */
+  size_t max_count;
+  /** @brief The number of points between snapshots, or zero if snapshots aren't taken by count. */
+  size_t snapshot_every;
+  /** @brief The number of seconds between snapshots, or zero if snapshots aren't taken by time. */
+  double snapshot_interval;
+} WindowOptions;
+
+/**
+ * @brief Parses a positive number of seconds.
+ * @param[in] string The string to parse.
+ * @param[out] seconds The number of seconds parsed from the string.
+ * @return Whether the whole string was a positive and finite number.
+ */
+static bool parse_seconds(const char* const string, double* const seconds) {
+  char* end;
+  const double parsed_seconds = strtod(string, &end);
+
+  if (end == string || *end != '\0' || !(parsed_seconds > 0) || !isfinite(parsed_seconds)) {
+    return false;
+  }
+
+  *seconds = parsed_seconds;
+
+  return true;
+}
+
+/**
+ * @brief Parses a positive decimal count.
+ * @param[in] string The string to parse.
+ * @param[out] count The count parsed from the string.
+ * @return Whether the whole string was a positive count.
+ */
+static bool parse_count(const char* const string, size_t* const count) {
+  if (string[0] < '0' || string[0] > '9') {
+    return false;
+  }
+
+  char* end;
+  const unsigned long parsed_count = strtoul(string, &end, 10);
+
+  if (*end != '\0' || parsed_count == 0) {
+    return false;
+  }
+
+  *count = parsed_count;
+
+  return true;
+}
+
+/**
+ * @brief Parses the command-line arguments of the sliding window program.
+ * @details `--duration=<seconds>` keeps the points that arrived within the last seconds, and `--count=<count>` keeps the
+ * last points. Both can be given, in which case a point leaves the window by either. `--every=<count>` takes a snapshot
+ * after every that many points, and `--interval=<seconds>` after every that many seconds of the stream's time. A
+ * snapshot is always taken at the end of the stream. This prints the program's usage if an argument is not recognized.
+ * @param arg_cnt The number of command-line arguments.
+ * @param[in] args The command-line arguments.
+ * @param[out] options The options set by the command-line arguments.
+ * @return Whether every argument was recognized.
+ */
+static bool parse_window_arguments(const int arg_cnt, char* const args[], WindowOptions* const options) {
+  options->duration = 0;
+  options->max_count = 0;
+  options->snapshot_every = 0;
+  options->snapshot_interval = 0;
+
+  bool is_recognized = true;
+
+  for (int i = 1; i < arg_cnt && is_recognized; i++) {
+    if (strncmp(args[i], "--duration=", 11) == 0) {
+      is_recognized = parse_seconds(&args[i][11], &options->duration);
+    } else if (strncmp(args[i], "--count=", 8) == 0) {
+      is_recognized = parse_count(&args[i][8], &options->max_count);
+    } else if (strncmp(args[i], "--every=", 8) == 0) {
+      is_recognized = parse_count(&args[i][8], &options->snapshot_every);
+    } else if (strncmp(args[i], "--interval=", 11) == 0) {
+      is_recognized = parse_seconds(&args[i][11], &options->snapshot_interval);
+    } else {
+      is_recognized = false;
+    }
+  }
+
+  if (!is_recognized || (options->duration == 0 && options->max_count == 0)) {
+    printf("Usage: %s [--duration=<seconds>] [--count=<count>] [--every=<count>] [--interval=<seconds>] "
+           "< <stream>\n",
+           args[0]);
+
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Writes a snapshot of a sliding window's convex hull to the standard output.
+ * @param[in] hull The sliding convex hull to use.
+ * @param time The time the snapshot is taken at, in seconds.
+ * @param[in,out] convex_points The buffer to copy the convex hull into. Reusing it across snapshots stops allocating
+ * once it is large enough.
+ * @return Whether the snapshot was written.
+ */
+static bool write_window_snapshot(const SlidingHull* const hull, const double time, PointBuffer* const convex_points) {
+  if (!reserve_points(convex_points, get_sliding_hull_point_count(hull))) {
+    return false;
+  }
+
+  convex_points->count = copy_sliding_hull_points(hull, convex_points->elements);
+
+  return write_snapshot(stdout, time, convex_points->elements, convex_points->count);
+}
+
+/**
+ * @brief The entry point of the sliding window convex hull program.
+ * @details Every line of the standard input contains a point's arrival time followed by its coordinates, in order of
+ * arrival. The convex hull of the window is written to the standard output at the chosen cadence. A malformed line is
+ * reported to the standard error and skipped.
+ * @param argc The number of command-line arguments.
+ * @param[in] argv The command-line arguments.
+ * @return The program's resulting exit code.
+ */
+int main(const int argc, char* argv[]) {
+  WindowOptions options;
+
+  if (!parse_window_arguments(argc, argv, &options)) {
+    return 1;
+  }
+
+  SlidingHull hull;
+  PointBuffer convex_points;
+
+  create_sliding_hull(&hull, options.duration, options.max_count);
+  create_point_buffer(&convex_points);
+
+  bool is_written = true;
+  bool has_malformed_lines = false;
+  bool has_unwritten_points = false;
+  size_t line_cnt = 0;
+  size_t point_cnt = 0;
+  double time = 0;
+  double next_snapshot_time = 0;
+  StreamLine line;
+  TimedPoint point;
+  bool is_parsed;
+
+  while (read_timed_point(stdin, line, &point, &is_parsed)) {
+    line_cnt++;
+
+    if (!is_parsed) {
+      fprintf(stderr, "Line %zu is malformed.\n", line_cnt);
+
+      has_malformed_lines = true;
+
+      continue;
+    }
+
+    if (!push_sliding_hull_point(&hull, point)) {
+      fprintf(stderr, "Line %zu could not be added to the window.\n", line_cnt);
+
+      is_written = false;
+
+      break;
+    }
+
+    // the first point starts the interval, so the first snapshot by time is taken one interval after it
+    if (point_cnt++ == 0) {
+      next_snapshot_time = point.time + options.snapshot_interval;
+    }
+
+    time = point.time;
+    has_unwritten_points = true;
+
+    const bool is_snapshot_due = (options.snapshot_every > 0 && point_cnt % options.snapshot_every == 0) ||
+                                 (options.snapshot_interval > 0 && time >= next_snapshot_time);
+
+    if (is_snapshot_due) {
+      if (!write_window_snapshot(&hull, time, &convex_points)) {
+        is_written = false;
+
+        break;
+      }
+
+      next_snapshot_time = time + options.snapshot_interval;
+      has_unwritten_points = false;
+    }
+  }
+
+  if (has_unwritten_points && is_written) {
+    is_written = write_window_snapshot(&hull, time, &convex_points);
+  }
+
+  if (fflush(stdout) != 0) {
+    is_written = false;
+  }
+
+  destroy_point_buffer(&convex_points);
+  destroy_sliding_hull(&hull);
+
+  return is_written && !has_malformed_lines ? 0 : 1;
+}